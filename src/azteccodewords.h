@@ -0,0 +1,332 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef AZTECCODEWORDS_DOT_H
+#define AZTECCODEWORDS_DOT_H
+
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include "gfbinary.h"
+#include "rsencoder.h"
+#include "rssplitencoder.h"
+#include "rsdecoder.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  The error correction layer of an Aztec Code symbol.  A compact
+     *  symbol has 1 to 4 layers and a full-range one 1 to 32, and the
+     *  layers hold
+     *
+     *      ((compact ? 88 : 112) + 16 L) L
+     *
+     *  bits, read as codewords of 6, 8, 10 or 12 bits for up to 2, 8, 22
+     *  and 32 layers - any bits left over are padding.  The encoder
+     *  chooses how many of the codewords hold data, and the rest are
+     *  check words of a Reed-Solomon code, with generator roots a^1,
+     *  a^2 ..., over the field of the codeword size:
+     *
+     *      6 bits      GFBinary<64, 0x43>
+     *      8 bits      GFBinary<256, 0x12D>, the Data Matrix field
+     *      10 bits     GFBinary<1024, 0x409>
+     *      12 bits     GFBinary<4096, 0x1069>
+     *
+     *  (tables in gfbinaryaztec.h and gfbinary256dm.h.)  The layer and
+     *  data codeword counts travel in the mode message around the
+     *  bullseye, itself protected by a Reed-Solomon code over
+     *  GFBinary<16, 0x13> - see encodeModeMessage.
+     *
+     *  A symbol is one long codeword with no blocks, up to 1664 symbols
+     *  over GF(4096), so the encoder is the shared split-table
+     *  RSSplitEncoder, and decoding runs in the SIMD kernels of
+     *  rskernels.h.  Only the codec of the symbol's codeword size is
+     *  built.
+     *
+     *  encode may be called from several threads at once, but decode uses
+     *  the object's workspace - use one AztecCodewords per thread for
+     *  decoding.  Like RSEncoder::get, the constructor must not run from
+     *  static initializers.
+     */
+    class AztecCodewords
+    {
+    public:
+        typedef GFBinary<16, 0x13> GF16;
+        typedef GFBinary<64, 0x43> GF64;
+        typedef GFBinary<256, 0x12D> GF256;
+        typedef GFBinary<1024, 0x409> GF1024;
+        typedef GFBinary<4096, 0x1069> GF4096;
+
+        static const size_t MAX_COMPACT_LAYERS = 4;
+        static const size_t MAX_LAYERS = 32;
+
+        /*
+         *  layers must be from 1 to 4 for a compact symbol and 1 to 32
+         *  for a full-range one, and numData from 1 to
+         *  getMaxDataCodewords(compact, layers).  Anything else gives an
+         *  object with no codewords, whose decode returns
+         *  RS_INVALID_LENGTH.
+         */
+        AztecCodewords(bool compact, size_t layers, size_t numData)
+            :   _compact(compact),
+                _layers(layers),
+                _wordSize(0),
+                _numCodewords(0),
+                _numData(0)
+        {
+            if (numData == 0 || numData > getMaxDataCodewords(compact, layers))
+            {
+                return;
+            }
+
+            _wordSize = getWordSize(layers);
+            _numCodewords = getNumCodewords(compact, layers);
+            _numData = numData;
+
+            size_t numCheck = _numCodewords - _numData;
+            if (_wordSize == 6)
+            {
+                _pCodec6.reset(new Codec<64, 0x43>(numCheck));
+            }
+            else if (_wordSize == 8)
+            {
+                _pCodec8.reset(new Codec<256, 0x12D>(numCheck));
+            }
+            else if (_wordSize == 10)
+            {
+                _pCodec10.reset(new Codec<1024, 0x409>(numCheck));
+            }
+            else
+            {
+                _pCodec12.reset(new Codec<4096, 0x1069>(numCheck));
+            }
+        }
+
+        /*
+         *  Bits per codeword in a symbol of the given layers.
+         */
+        static size_t getWordSize(size_t layers)
+        {
+            if (layers <= 2)
+            {
+                return 6;
+            }
+            if (layers <= 8)
+            {
+                return 8;
+            }
+            if (layers <= 22)
+            {
+                return 10;
+            }
+            return 12;
+        }
+
+        /*
+         *  Codewords, data and check, in a symbol - 0 if there is no such
+         *  symbol.
+         */
+        static size_t getNumCodewords(bool compact, size_t layers)
+        {
+            if (layers == 0 || layers > (compact ? MAX_COMPACT_LAYERS : MAX_LAYERS))
+            {
+                return 0;
+            }
+
+            size_t bits = ((compact ? 88 : 112) + 16 * layers) * layers;
+            return bits / getWordSize(layers);
+        }
+
+        /*
+         *  The most data codewords the mode message can describe and
+         *  still leave a check word:  64 for compact symbols, whose mode
+         *  message has 6 bits for the count, and 2048 for full-range
+         *  ones.
+         */
+        static size_t getMaxDataCodewords(bool compact, size_t layers)
+        {
+            size_t numCodewords = getNumCodewords(compact, layers);
+            size_t limit = compact ? 64 : 2048;
+            return numCodewords == 0 ? 0 : (numCodewords - 1 < limit ? numCodewords - 1 : limit);
+        }
+
+        bool isCompact() const
+        {
+            return _compact;
+        }
+
+        size_t getLayers() const
+        {
+            return _layers;
+        }
+
+        size_t getWordSize() const
+        {
+            return _wordSize;
+        }
+
+        size_t getNumCodewords() const
+        {
+            return _numCodewords;
+        }
+
+        size_t getNumDataCodewords() const
+        {
+            return _numData;
+        }
+
+        size_t getNumCheckCodewords() const
+        {
+            return _numCodewords - _numData;
+        }
+
+        /*
+         *  Computes the getNumCheckCodewords() check words for the
+         *  getNumDataCodewords() data codewords, each below
+         *  2^getWordSize().  The symbol places them after the data.
+         */
+        void encode(const uint16_t *pData, uint16_t *pCheck) const
+        {
+            if (_pCodec6)
+            {
+                _pCodec6->pEncoder->encode(pData, _numData, pCheck);
+            }
+            else if (_pCodec8)
+            {
+                _pCodec8->pEncoder->encode(pData, _numData, pCheck);
+            }
+            else if (_pCodec10)
+            {
+                _pCodec10->pEncoder->encode(pData, _numData, pCheck);
+            }
+            else if (_pCodec12)
+            {
+                _pCodec12->pEncoder->encode(pData, _numData, pCheck);
+            }
+        }
+
+        /*
+         *  Corrects the getNumCodewords() data and check words in place,
+         *  given the indexes of any codewords known to be unreadable.  If
+         *  they cannot be corrected they are left unchanged.
+         */
+        RSDecodeStatus decode(uint16_t *pCodewords, const size_t *pErasures = 0, size_t numErasures = 0)
+        {
+            if (_pCodec6)
+            {
+                return _pCodec6->decoder.decode(pCodewords, _numCodewords, pErasures, numErasures);
+            }
+            if (_pCodec8)
+            {
+                return _pCodec8->decoder.decode(pCodewords, _numCodewords, pErasures, numErasures);
+            }
+            if (_pCodec10)
+            {
+                return _pCodec10->decoder.decode(pCodewords, _numCodewords, pErasures, numErasures);
+            }
+            if (_pCodec12)
+            {
+                return _pCodec12->decoder.decode(pCodewords, _numCodewords, pErasures, numErasures);
+            }
+
+            return RS_INVALID_LENGTH;
+        }
+
+        /*
+         *  Four-bit words in the mode message:  2 data and 5 check words
+         *  in a compact symbol, 4 and 6 in a full-range one.
+         */
+        static size_t getModeMessageLength(bool compact)
+        {
+            return compact ? 7 : 10;
+        }
+
+        /*
+         *  Builds the mode message, most significant word first.  Its
+         *  data is layers - 1 (2 bits compact, 5 bits full-range) then
+         *  numData - 1 (6 or 11 bits), followed by the check words.
+         */
+        static void encodeModeMessage(bool compact, size_t layers, size_t numData, uint8_t *pWords)
+        {
+            size_t numWords = getModeMessageLength(compact);
+            size_t numDataWords = compact ? 2 : 4;
+            uint32_t bits = static_cast<uint32_t>(((layers - 1) << (compact ? 6 : 11)) | (numData - 1));
+            for (size_t i = 0; i < numDataWords; i++)
+            {
+                pWords[i] = static_cast<uint8_t>((bits >> (4 * (numDataWords - 1 - i))) & 0xF);
+            }
+
+            RSEncoder<GF16>::get(numWords - numDataWords, 1, GF16(2))->encode(pWords, numDataWords, pWords + numDataWords);
+        }
+
+        /*
+         *  Corrects a mode message in place and reads the layers and
+         *  data codewords from it.  Returns false, leaving the outputs
+         *  unchanged, if it cannot be corrected.
+         */
+        static bool decodeModeMessage(bool compact, uint8_t *pWords, size_t& layers, size_t& numData)
+        {
+            size_t numWords = getModeMessageLength(compact);
+            size_t numDataWords = compact ? 2 : 4;
+            RSDecoder<GF16> decoder(numWords - numDataWords, 1, GF16(2));
+            RSDecodeStatus status = decoder.decode(pWords, numWords);
+            if (status != RS_NO_ERRORS && status != RS_CORRECTED)
+            {
+                return false;
+            }
+
+            uint32_t bits = 0;
+            for (size_t i = 0; i < numDataWords; i++)
+            {
+                bits = (bits << 4) | pWords[i];
+            }
+
+            size_t numDataBits = compact ? 6 : 11;
+            layers = (bits >> numDataBits) + 1;
+            numData = (bits & ((1u << numDataBits) - 1)) + 1;
+            return true;
+        }
+
+    private:
+        AztecCodewords(const AztecCodewords&);
+        AztecCodewords& operator=(const AztecCodewords&);
+
+        template<unsigned int SIZE, unsigned int POLYNOMIAL>
+        struct Codec
+        {
+            Codec(size_t numCheck)
+                :   pEncoder(RSSplitEncoder<SIZE, POLYNOMIAL>::get(numCheck, 1, GFBinary<SIZE, POLYNOMIAL>(2))),
+                    decoder(numCheck, 1, GFBinary<SIZE, POLYNOMIAL>(2))
+            {
+            }
+
+            std::shared_ptr<const RSSplitEncoder<SIZE, POLYNOMIAL> >    pEncoder;
+            RSDecoder<GFBinary<SIZE, POLYNOMIAL> >                      decoder;
+        };
+
+        bool                                            _compact;
+        size_t                                          _layers;
+        size_t                                          _wordSize;
+        size_t                                          _numCodewords;
+        size_t                                          _numData;
+        std::shared_ptr<Codec<64, 0x43> >               _pCodec6;
+        std::shared_ptr<Codec<256, 0x12D> >             _pCodec8;
+        std::shared_ptr<Codec<1024, 0x409> >            _pCodec10;
+        std::shared_ptr<Codec<4096, 0x1069> >           _pCodec12;
+    };
+}
+
+#endif  // AZTECCODEWORDS_DOT_H
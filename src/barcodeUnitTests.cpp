@@ -0,0 +1,612 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+/*
+ *  Unit tests for the barcode symbology error correction layers.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <assert.h>
+#include "eccUtils.h"
+#include "gfbinary.h"
+#include "gfprime.h"
+#include "eccThreadPool.h"
+#include "rsencoder.h"
+#include "qrcodewords.h"
+#include "pdf417codewords.h"
+#include "datamatrixcodewords.h"
+#include "azteccodewords.h"
+#include "eccCommonUnitTests.h"
+
+using namespace SilverBayTech;
+using namespace std;
+
+typedef GFBinary<256> GF256;
+typedef GFPrime<929> GF929;
+typedef GFBinary<256, 0x12D> GFDM;
+
+static const uint8_t INPUT_256[] = {0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11};
+
+static const uint16_t INPUT_929[] = {5, 453, 178, 121, 239};
+
+static uint32_t s_randomState = 97531;
+static uint32_t nextRandom(void)
+{
+    s_randomState = s_randomState * 1103515245 + 12345;
+    return s_randomState >> 8;
+}
+
+static void qr_layoutMatchesStandard(void)
+{
+    static const QREccLevel LEVELS[] = { QR_ECC_L, QR_ECC_M, QR_ECC_Q, QR_ECC_H };
+
+    assert(QRCodewords(1, QR_ECC_M).getNumDataCodewords() == 16);
+    assert(QRCodewords(1, QR_ECC_M).getNumCodewords() == 26);
+    assert(QRCodewords(5, QR_ECC_Q).getNumDataCodewords() == 62);
+    assert(QRCodewords(10, QR_ECC_H).getNumDataCodewords() == 122);
+    assert(QRCodewords(40, QR_ECC_L).getNumDataCodewords() == 2956);
+    assert(QRCodewords(40, QR_ECC_H).getNumDataCodewords() == 1276);
+    assert(QRCodewords(40, QR_ECC_H).getNumCodewords() == 3706);
+
+    for (size_t version = QRCodewords::MIN_VERSION; version <= QRCodewords::MAX_VERSION; version++)
+    {
+        size_t previous = 0;
+        for (size_t l = 0; l < ARRAY_LENGTH(LEVELS); l++)
+        {
+            QRCodewords qr(version, LEVELS[l]);
+            size_t numData = 0;
+            for (size_t k = 0; k < qr.getNumBlocks(); k++)
+            {
+                numData += qr.getBlockDataLength(k);
+                assert(qr.getBlockDataLength(k) + qr.getNumEccPerBlock() <= 255);
+            }
+            assert(numData == qr.getNumDataCodewords());
+            assert(numData + qr.getNumBlocks() * qr.getNumEccPerBlock() == qr.getNumCodewords());
+            assert(l == 0 || numData < previous);
+            previous = numData;
+        }
+    }
+
+    assert(!QRCodewords::isValidVersion(0));
+    assert(!QRCodewords::isValidVersion(QRCodewords::MAX_VERSION + 1));
+    uint8_t none = 0;
+    QRCodewords tooSmall(0, QR_ECC_M);
+    assert(tooSmall.getNumCodewords() == 0);
+    assert(tooSmall.decode(&none, &none) == RS_INVALID_LENGTH);
+    QRCodewords tooLarge(QRCodewords::MAX_VERSION + 1, QR_ECC_H);
+    assert(tooLarge.getNumCodewords() == 0);
+    assert(tooLarge.decode(&none, &none) == RS_INVALID_LENGTH);
+}
+
+/*
+ *  Version 1-M is one block, which is exactly what rs256sample computes.
+ */
+static void qr_matchesSample(void)
+{
+    QRCodewords qr(1, QR_ECC_M);
+    std::vector<uint8_t> codewords(qr.getNumCodewords());
+    qr.encode(INPUT_256, &codewords[0]);
+
+    std::vector<uint8_t> parity(10);
+    RSEncoder<GF256>(10, 0, GF256(2)).encode(INPUT_256, ARRAY_LENGTH(INPUT_256), &parity[0]);
+    assert(std::equal(INPUT_256, INPUT_256 + ARRAY_LENGTH(INPUT_256), codewords.begin()));
+    assert(std::equal(parity.begin(), parity.end(), codewords.begin() + ARRAY_LENGTH(INPUT_256)));
+}
+
+/*
+ *  5-Q has two blocks of 15 data codewords and two of 16.
+ */
+static void qr_interleavesBlocks(void)
+{
+    QRCodewords qr(5, QR_ECC_Q);
+    std::vector<uint8_t> data(qr.getNumDataCodewords());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    std::vector<uint8_t> codewords(qr.getNumCodewords());
+    qr.encode(&data[0], &codewords[0]);
+
+    static const uint8_t EXPECTED_START[] = { 0, 15, 30, 46, 1, 16, 31, 47 };
+    assert(std::equal(EXPECTED_START, EXPECTED_START + ARRAY_LENGTH(EXPECTED_START), codewords.begin()));
+    assert(codewords[56] == 14 && codewords[57] == 29 && codewords[58] == 44 && codewords[59] == 60);
+    assert(codewords[60] == 45 && codewords[61] == 61);
+
+    std::vector<uint8_t> parity(18);
+    RSEncoder<GF256>(18, 0, GF256(2)).encode(&data[46], 16, &parity[0]);
+    for (size_t j = 0; j < parity.size(); j++)
+    {
+        assert(codewords[62 + 4 * j + 3] == parity[j]);
+    }
+}
+
+/*
+ *  Damages every block up to its capacity, then one block past it.
+ */
+static void checkQrRoundTrip(size_t version, QREccLevel level, EccThreadPool *pPool)
+{
+    QRCodewords qr(version, level, pPool);
+    std::vector<uint8_t> data(qr.getNumDataCodewords());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(nextRandom());
+    }
+
+    std::vector<uint8_t> codewords(qr.getNumCodewords());
+    qr.encode(&data[0], &codewords[0]);
+
+    std::vector<uint8_t> decoded(data.size());
+    assert(qr.decode(&codewords[0], &decoded[0]) == RS_NO_ERRORS);
+    assert(decoded == data);
+
+    size_t numBlocks = qr.getNumBlocks();
+    size_t numData = qr.getNumDataCodewords();
+    std::vector<uint8_t> damaged(codewords);
+    for (size_t k = 0; k < numBlocks; k++)
+    {
+        size_t numErrors = (k % 2 == 0) ? qr.getNumEccPerBlock() / 2 : k % 3;
+        for (size_t e = 0; e < numErrors; e++)
+        {
+            size_t position = (e % 2 == 0) ? e * numBlocks + k : numData + e * numBlocks + k;
+            damaged[position] ^= static_cast<uint8_t>(nextRandom() % 255 + 1);
+        }
+    }
+
+    std::fill(decoded.begin(), decoded.end(), 0);
+    assert(qr.decode(&damaged[0], &decoded[0]) == RS_CORRECTED);
+    assert(decoded == data);
+
+    for (size_t j = 0; j <= qr.getNumEccPerBlock() / 2; j++)
+    {
+        damaged[numData + j * numBlocks + numBlocks - 1] ^= 0x5A;
+    }
+    assert(qr.decode(&damaged[0], &decoded[0]) == RS_UNCORRECTABLE);
+}
+
+static void qr_decodesDamagedSymbols(void)
+{
+    EccThreadPool pool(2);
+
+    checkQrRoundTrip(1, QR_ECC_L, 0);
+    checkQrRoundTrip(5, QR_ECC_Q, 0);
+    checkQrRoundTrip(13, QR_ECC_H, &pool);
+    checkQrRoundTrip(27, QR_ECC_M, &pool);
+    checkQrRoundTrip(40, QR_ECC_L, &pool);
+    checkQrRoundTrip(40, QR_ECC_H, 0);
+}
+
+/*
+ *  Level 1 is rs929sample's code; the codewords are the example in the
+ *  PDF417 specification.
+ */
+static void pdf417_matchesSample(void)
+{
+    static const uint16_t EXPECTED[] = {452, 327, 657, 619};
+
+    PDF417Codewords pdf417(1);
+    assert(pdf417.getNumEcc() == 4);
+
+    uint16_t ecc[4];
+    pdf417.encode(INPUT_929, ARRAY_LENGTH(INPUT_929), ecc);
+    assert(std::equal(EXPECTED, EXPECTED + ARRAY_LENGTH(EXPECTED), ecc));
+
+    assert(PDF417Codewords::getNumEcc(8) == 512);
+    assert(PDF417Codewords(8).getMaxDataCodewords() == 416);
+    assert(PDF417Codewords::getRecommendedLevel(40) == 2);
+    assert(PDF417Codewords::getRecommendedLevel(41) == 3);
+    assert(PDF417Codewords::getRecommendedLevel(863) == 5);
+}
+
+/*
+ *  Fills the capacity with errors and erasures, less the two codewords
+ *  kept for detection, then goes one past it.
+ */
+static void checkPdf417RoundTrip(size_t level, size_t numData)
+{
+    PDF417Codewords pdf417(level);
+    size_t numEcc = pdf417.getNumEcc();
+    size_t numCodewords = numData + numEcc;
+
+    std::vector<uint16_t> codewords(numCodewords);
+    for (size_t i = 0; i < numData; i++)
+    {
+        codewords[i] = static_cast<uint16_t>(nextRandom() % 929);
+    }
+    pdf417.encode(&codewords[0], numData, &codewords[numData]);
+
+    std::vector<uint16_t> received(codewords);
+    assert(pdf417.decode(&received[0], numCodewords) == RS_NO_ERRORS);
+    assert(received == codewords);
+
+    size_t numErasures = (numEcc - 2) / 3;
+    size_t numErrors = (numEcc - 2 - numErasures) / 2;
+    std::vector<size_t> positions;
+    while (positions.size() < numErasures + numErrors + 1)
+    {
+        size_t position = nextRandom() % numCodewords;
+        if (std::find(positions.begin(), positions.end(), position) == positions.end())
+        {
+            positions.push_back(position);
+        }
+    }
+
+    for (size_t k = 0; k < numErasures + numErrors; k++)
+    {
+        received[positions[k]] = static_cast<uint16_t>((received[positions[k]] + 1 + nextRandom() % 928) % 929);
+    }
+
+    std::vector<uint16_t> damaged(received);
+    RSDecodeStatus expected = (numEcc > 2) ? RS_CORRECTED : RS_NO_ERRORS;
+    assert(pdf417.decode(&received[0], numCodewords, &positions[0], numErasures) == expected);
+    assert(received == codewords);
+
+    /*
+     *  One more error would still be within the code's reach when
+     *  numErasures + 2 numErrors is two short of numEcc, but not within
+     *  PDF417's.
+     */
+    size_t extra = positions[numErasures + numErrors];
+    damaged[extra] = static_cast<uint16_t>((damaged[extra] + 1) % 929);
+    received = damaged;
+    assert(pdf417.decode(&received[0], numCodewords, &positions[0], numErasures) == RS_UNCORRECTABLE);
+    assert(received == damaged);
+}
+
+static void pdf417_decodesDamagedSymbols(void)
+{
+    checkPdf417RoundTrip(0, 10);
+    checkPdf417RoundTrip(1, ARRAY_LENGTH(INPUT_929));
+    checkPdf417RoundTrip(2, 40);
+    checkPdf417RoundTrip(4, 300);
+    checkPdf417RoundTrip(5, 864);
+    checkPdf417RoundTrip(8, 416);
+}
+
+static void dm_layoutMatchesStandard(void)
+{
+    static const size_t SIZES[][2] =
+    {
+        { 10, 10 }, { 12, 12 }, { 14, 14 }, { 16, 16 }, { 18, 18 }, { 20, 20 }, { 22, 22 }, { 24, 24 },
+        { 26, 26 }, { 32, 32 }, { 36, 36 }, { 40, 40 }, { 44, 44 }, { 48, 48 }, { 52, 52 }, { 64, 64 },
+        { 72, 72 }, { 80, 80 }, { 88, 88 }, { 96, 96 }, { 104, 104 }, { 120, 120 }, { 132, 132 }, { 144, 144 },
+        { 8, 18 }, { 8, 32 }, { 12, 26 }, { 12, 36 }, { 16, 36 }, { 16, 48 }
+    };
+
+    assert(ARRAY_LENGTH(SIZES) == DataMatrixCodewords::NUM_SIZES);
+    for (size_t s = 0; s < ARRAY_LENGTH(SIZES); s++)
+    {
+        DataMatrixCodewords dm(SIZES[s][0], SIZES[s][1]);
+        assert(DataMatrixCodewords::isValidSize(SIZES[s][0], SIZES[s][1]));
+
+        size_t numData = 0;
+        for (size_t k = 0; k < dm.getNumBlocks(); k++)
+        {
+            numData += dm.getBlockDataLength(k);
+            assert(dm.getBlockDataLength(k) + dm.getNumEccPerBlock() <= 255);
+        }
+        assert(numData == dm.getNumDataCodewords());
+    }
+
+    assert(DataMatrixCodewords(10, 10).getNumCodewords() == 8);
+    assert(DataMatrixCodewords(52, 52).getNumCodewords() == 288);
+    assert(DataMatrixCodewords(144, 144).getNumCodewords() == 2178);
+    assert(DataMatrixCodewords(16, 48).getNumCodewords() == 77);
+
+    assert(!DataMatrixCodewords::isValidSize(18, 8));
+    assert(!DataMatrixCodewords::isValidSize(28, 28));
+    DataMatrixCodewords invalid(28, 28);
+    assert(invalid.getNumCodewords() == 0);
+    uint8_t none = 0;
+    assert(invalid.decode(&none, &none) == RS_INVALID_LENGTH);
+}
+
+/*
+ *  "123456" in a 10 x 10 symbol, the example in the Data Matrix
+ *  specification.
+ */
+static void dm_matchesSample(void)
+{
+    static const uint8_t DATA[] = { 142, 164, 186 };
+    static const uint8_t EXPECTED[] = { 142, 164, 186, 114, 25, 5, 88, 102 };
+
+    DataMatrixCodewords dm(10, 10);
+    uint8_t codewords[ARRAY_LENGTH(EXPECTED)];
+    dm.encode(DATA, codewords);
+    assert(std::equal(EXPECTED, EXPECTED + ARRAY_LENGTH(EXPECTED), codewords));
+
+    std::vector<uint8_t> parity(5);
+    RSEncoder<GFDM>(5, 1, GFDM(2)).encode(DATA, ARRAY_LENGTH(DATA), &parity[0]);
+    assert(std::equal(parity.begin(), parity.end(), EXPECTED + ARRAY_LENGTH(DATA)));
+}
+
+/*
+ *  144 x 144 has ten blocks, the last two a data codeword short.
+ */
+static void dm_interleavesBlocks(void)
+{
+    DataMatrixCodewords dm(144, 144);
+    assert(dm.getNumBlocks() == 10);
+    assert(dm.getBlockDataLength(0) == 156 && dm.getBlockDataLength(7) == 156);
+    assert(dm.getBlockDataLength(8) == 155 && dm.getBlockDataLength(9) == 155);
+
+    std::vector<uint8_t> data(dm.getNumDataCodewords());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(nextRandom());
+    }
+
+    std::vector<uint8_t> codewords(dm.getNumCodewords());
+    dm.encode(&data[0], &codewords[0]);
+    assert(std::equal(data.begin(), data.end(), codewords.begin()));
+
+    std::vector<uint8_t> block;
+    for (size_t i = 9; i < data.size(); i += 10)
+    {
+        block.push_back(data[i]);
+    }
+
+    std::vector<uint8_t> parity(62);
+    RSEncoder<GFDM>(62, 1, GFDM(2)).encode(&block[0], block.size(), &parity[0]);
+    for (size_t j = 0; j < parity.size(); j++)
+    {
+        assert(codewords[1558 + 10 * j + 9] == parity[j]);
+    }
+}
+
+/*
+ *  Damages every block up to its capacity, then one block past it.
+ */
+static void checkDmRoundTrip(size_t rows, size_t columns, EccThreadPool *pPool)
+{
+    DataMatrixCodewords dm(rows, columns, pPool);
+    std::vector<uint8_t> data(dm.getNumDataCodewords());
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(nextRandom());
+    }
+
+    std::vector<uint8_t> codewords(dm.getNumCodewords());
+    dm.encode(&data[0], &codewords[0]);
+
+    std::vector<uint8_t> decoded(data.size());
+    assert(dm.decode(&codewords[0], &decoded[0]) == RS_NO_ERRORS);
+    assert(decoded == data);
+
+    size_t numBlocks = dm.getNumBlocks();
+    size_t numData = dm.getNumDataCodewords();
+    std::vector<uint8_t> damaged(codewords);
+    for (size_t k = 0; k < numBlocks; k++)
+    {
+        for (size_t e = 0; e < dm.getNumEccPerBlock() / 2; e++)
+        {
+            size_t position = (e % 2 == 0) ? e * numBlocks + k : numData + e * numBlocks + k;
+            damaged[position] ^= static_cast<uint8_t>(nextRandom() % 255 + 1);
+        }
+    }
+
+    std::fill(decoded.begin(), decoded.end(), 0);
+    assert(dm.decode(&damaged[0], &decoded[0]) == RS_CORRECTED);
+    assert(decoded == data);
+
+    for (size_t j = 0; j <= dm.getNumEccPerBlock() / 2; j++)
+    {
+        damaged[numData + j * numBlocks] ^= 0x5A;
+    }
+    assert(dm.decode(&damaged[0], &decoded[0]) == RS_UNCORRECTABLE);
+}
+
+static void dm_decodesDamagedSymbols(void)
+{
+    EccThreadPool pool(2);
+
+    checkDmRoundTrip(10, 10, 0);
+    checkDmRoundTrip(16, 48, 0);
+    checkDmRoundTrip(48, 48, 0);
+    checkDmRoundTrip(64, 64, &pool);
+    checkDmRoundTrip(144, 144, &pool);
+
+    /*
+     *  QR Code and Data Matrix symbols decoded side by side.
+     */
+    checkQrRoundTrip(10, QR_ECC_M, &pool);
+    checkDmRoundTrip(120, 120, &pool);
+}
+
+static void aztec_layoutMatchesStandard(void)
+{
+    assert(AztecCodewords::getNumCodewords(true, 1) == 17);
+    assert(AztecCodewords::getNumCodewords(true, 4) == 76);
+    assert(AztecCodewords::getNumCodewords(false, 1) == 21);
+    assert(AztecCodewords::getNumCodewords(false, 8) == 240);
+    assert(AztecCodewords::getNumCodewords(false, 22) == 1020);
+    assert(AztecCodewords::getNumCodewords(false, 32) == 1664);
+    assert(AztecCodewords::getNumCodewords(true, 5) == 0);
+    assert(AztecCodewords::getNumCodewords(false, 33) == 0);
+
+    assert(AztecCodewords::getWordSize(2) == 6);
+    assert(AztecCodewords::getWordSize(3) == 8);
+    assert(AztecCodewords::getWordSize(22) == 10);
+    assert(AztecCodewords::getWordSize(23) == 12);
+
+    assert(AztecCodewords::getMaxDataCodewords(true, 1) == 16);
+    assert(AztecCodewords::getMaxDataCodewords(true, 4) == 64);
+    assert(AztecCodewords::getMaxDataCodewords(false, 32) == 1663);
+
+    AztecCodewords aztec(false, 10, 268);
+    assert(aztec.getWordSize() == 10);
+    assert(aztec.getNumCodewords() == 272);
+    assert(aztec.getNumCheckCodewords() == 4);
+
+    std::vector<uint16_t> codewords(AztecCodewords::getNumCodewords(true, 4));
+    AztecCodewords tooLong(true, 4, 65);
+    assert(tooLong.getNumCodewords() == 0);
+    assert(tooLong.decode(&codewords[0]) == RS_INVALID_LENGTH);
+}
+
+/*
+ *  Mode messages of published Aztec symbols, one bit per module.
+ */
+static void checkModeMessage(bool compact, size_t layers, size_t numData, const char *pExpected)
+{
+    uint8_t words[10];
+    AztecCodewords::encodeModeMessage(compact, layers, numData, words);
+
+    size_t b = 0;
+    for (size_t i = 0; i < AztecCodewords::getModeMessageLength(compact); i++)
+    {
+        for (size_t bit = 4; bit > 0; bit--)
+        {
+            while (pExpected[b] == ' ')
+            {
+                b++;
+            }
+            assert(pExpected[b++] == (((words[i] >> (bit - 1)) & 1) ? 'X' : '.'));
+        }
+    }
+    assert(pExpected[b] == 0);
+}
+
+static void aztec_modeMessageMatchesSample(void)
+{
+    checkModeMessage(true, 2, 29, ".X .XXX.. ...X XX.. ..X .XX. .XX.X");
+    checkModeMessage(true, 4, 64, "XX XXXXXX .X.. ...X ..XX .X.. XX..");
+    checkModeMessage(false, 21, 660, "X.X.. .X.X..X..XX .XXX ..X.. .XXX. .X... ..XXX");
+}
+
+static void aztec_modeMessageCorrectsErrors(void)
+{
+    for (size_t layers = 1; layers <= AztecCodewords::MAX_LAYERS; layers++)
+    {
+        bool compact = layers <= AztecCodewords::MAX_COMPACT_LAYERS && layers % 2 == 0;
+        size_t numData = nextRandom() % AztecCodewords::getMaxDataCodewords(compact, layers) + 1;
+        size_t length = AztecCodewords::getModeMessageLength(compact);
+
+        uint8_t words[10];
+        AztecCodewords::encodeModeMessage(compact, layers, numData, words);
+        size_t numErrors = compact ? 2 : 3;
+        for (size_t e = 0; e < numErrors; e++)
+        {
+            words[(3 * e + layers) % length] ^= static_cast<uint8_t>(nextRandom() % 15 + 1);
+        }
+
+        size_t decodedLayers = 0;
+        size_t decodedData = 0;
+        assert(AztecCodewords::decodeModeMessage(compact, words, decodedLayers, decodedData));
+        assert(decodedLayers == layers);
+        assert(decodedData == numData);
+    }
+}
+
+/*
+ *  Corrects half the check words as errors, then errors and erasures
+ *  together, then fails one error past capacity.
+ */
+static void checkAztecRoundTrip(bool compact, size_t layers, size_t numData)
+{
+    AztecCodewords aztec(compact, layers, numData);
+    size_t numCheck = aztec.getNumCheckCodewords();
+    std::vector<uint16_t> codewords(aztec.getNumCodewords());
+    for (size_t i = 0; i < numData; i++)
+    {
+        codewords[i] = static_cast<uint16_t>(nextRandom() % (1u << aztec.getWordSize()));
+    }
+    aztec.encode(&codewords[0], &codewords[numData]);
+
+    std::vector<uint16_t> received(codewords);
+    assert(aztec.decode(&received[0]) == RS_NO_ERRORS);
+
+    std::vector<size_t> positions;
+    for (size_t e = 0; e < numCheck / 2 + 1; e++)
+    {
+        positions.push_back((e * 7919 + layers) % codewords.size());
+    }
+    std::sort(positions.begin(), positions.end());
+    positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+    positions.resize(std::min(positions.size(), numCheck / 2));
+
+    for (size_t e = 0; e < positions.size(); e++)
+    {
+        received[positions[e]] ^= static_cast<uint16_t>(nextRandom() % ((1u << aztec.getWordSize()) - 1) + 1);
+    }
+    assert(aztec.decode(&received[0]) == (positions.empty() ? RS_NO_ERRORS : RS_CORRECTED));
+    assert(received == codewords);
+
+    std::vector<size_t> erasures;
+    for (size_t e = 0; e < numCheck / 2; e++)
+    {
+        size_t position = (e * 31 + 5) % codewords.size();
+        if (std::find(erasures.begin(), erasures.end(), position) == erasures.end())
+        {
+            erasures.push_back(position);
+            received[position] = 0;
+        }
+    }
+    for (size_t e = 0; e < (numCheck - erasures.size()) / 2; e++)
+    {
+        size_t position = (e * 31 + 20) % codewords.size();
+        if (std::find(erasures.begin(), erasures.end(), position) == erasures.end())
+        {
+            received[position] ^= 1;
+        }
+    }
+    assert(aztec.decode(&received[0], &erasures[0], erasures.size()) != RS_UNCORRECTABLE);
+    assert(received == codewords);
+
+    if (numCheck >= 8)
+    {
+        for (size_t e = 0; e <= numCheck / 2; e++)
+        {
+            received[e] ^= 1;
+        }
+        std::vector<uint16_t> damaged(received);
+        assert(aztec.decode(&received[0]) == RS_UNCORRECTABLE);
+        assert(received == damaged);
+    }
+}
+
+static void aztec_decodesDamagedSymbols(void)
+{
+    checkAztecRoundTrip(true, 1, 10);
+    checkAztecRoundTrip(true, 2, 20);
+    checkAztecRoundTrip(true, 4, 50);
+    checkAztecRoundTrip(false, 2, 30);
+    checkAztecRoundTrip(false, 5, 100);
+    checkAztecRoundTrip(false, 9, 150);
+    checkAztecRoundTrip(false, 22, 780);
+    checkAztecRoundTrip(false, 23, 800);
+    checkAztecRoundTrip(false, 32, 1264);
+}
+
+void barcodeUnitTests(void)
+{
+    qr_layoutMatchesStandard();
+    qr_matchesSample();
+    qr_interleavesBlocks();
+    qr_decodesDamagedSymbols();
+    pdf417_matchesSample();
+    pdf417_decodesDamagedSymbols();
+    dm_layoutMatchesStandard();
+    dm_matchesSample();
+    dm_interleavesBlocks();
+    dm_decodesDamagedSymbols();
+    aztec_layoutMatchesStandard();
+    aztec_modeMessageMatchesSample();
+    aztec_modeMessageCorrectsErrors();
+    aztec_decodesDamagedSymbols();
+}
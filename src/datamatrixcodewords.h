@@ -0,0 +1,269 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef DATAMATRIXCODEWORDS_DOT_H
+#define DATAMATRIXCODEWORDS_DOT_H
+
+#include <vector>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include "eccThreadPool.h"
+#include "gfbinary.h"
+#include "rstableencoder.h"
+#include "rsbatchdecoder.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  The error correction layer of a Data Matrix ECC 200 symbol.  The
+     *  Reed-Solomon code is over GF(256) with polynomial 0x12D
+     *  (GFBinary<256, 0x12D>, tables in gfbinary256dm.h), with generator
+     *  roots a^1, a^2 ... - a different field from QR Code's, but the
+     *  same table encoder and SIMD decoder kernels.
+     *
+     *  Each of the 30 symbol sizes has a fixed number of data and error
+     *  correction codewords.  The larger ones split them into b blocks
+     *  with the same number of error correction codewords each.  Unlike
+     *  QR Code, the blocks are interleaved codeword by codeword:  data
+     *  codeword i belongs to block i mod b, and error correction
+     *  codeword j of block k comes at j b + k after the data.  Only the
+     *  144 x 144 symbol has blocks of different lengths - its last two
+     *  blocks are one data codeword short.
+     *
+     *  Encoding and decoding work the way QRCodewords' do, and decoding
+     *  may likewise use a thread pool.
+     */
+    class DataMatrixCodewords
+    {
+    public:
+        typedef GFBinary<256, 0x12D> GFDM;
+
+        static const size_t NUM_SIZES = 30;
+
+        /*
+         *  rows by columns must be one of the ECC 200 sizes (see
+         *  isValidSize.)  Any other size gives an object with no
+         *  codewords, whose decode returns RS_INVALID_LENGTH.
+         */
+        DataMatrixCodewords(size_t rows, size_t columns, EccThreadPool *pPool = 0)
+            :   _rows(rows),
+                _columns(columns),
+                _numBlocks(tableEntry(rows, columns).numBlocks),
+                _numEcc(tableEntry(rows, columns).numEcc),
+                _numData(tableEntry(rows, columns).numData)
+        {
+            if (_numBlocks == 0)
+            {
+                return;
+            }
+
+            _pEncoder = RSTableEncoder::get(_numEcc, 1, GFDM(2));
+            _pDecoder.reset(new RSBatchDecoder<GFDM>(_numEcc, 1, GFDM(2), pPool, 1));
+        }
+
+        static bool isValidSize(size_t rows, size_t columns)
+        {
+            return tableEntry(rows, columns).numBlocks != 0;
+        }
+
+        size_t getRows() const
+        {
+            return _rows;
+        }
+
+        size_t getColumns() const
+        {
+            return _columns;
+        }
+
+        /*
+         *  Total codewords in the symbol, data and error correction.
+         */
+        size_t getNumCodewords() const
+        {
+            return _numData + _numBlocks * _numEcc;
+        }
+
+        size_t getNumDataCodewords() const
+        {
+            return _numData;
+        }
+
+        size_t getNumBlocks() const
+        {
+            return _numBlocks;
+        }
+
+        /*
+         *  Error correction codewords in each block.
+         */
+        size_t getNumEccPerBlock() const
+        {
+            return _numEcc;
+        }
+
+        /*
+         *  Data codewords in block k.
+         */
+        size_t getBlockDataLength(size_t k) const
+        {
+            return (_numData - k + _numBlocks - 1) / _numBlocks;
+        }
+
+        /*
+         *  Encodes getNumDataCodewords() bytes of data into the
+         *  getNumCodewords() bytes of the final sequence.
+         */
+        void encode(const uint8_t *pData, uint8_t *pCodewords) const
+        {
+            uint8_t block[MAX_BLOCK_DATA];
+            uint8_t parity[RSTableEncoder::MAX_PARITY];
+            for (size_t k = 0; k < _numBlocks; k++)
+            {
+                size_t length = getBlockDataLength(k);
+                for (size_t i = 0; i < length; i++)
+                {
+                    block[i] = pData[i * _numBlocks + k];
+                    pCodewords[i * _numBlocks + k] = block[i];
+                }
+
+                _pEncoder->encode(block, length, parity);
+                for (size_t j = 0; j < _numEcc; j++)
+                {
+                    pCodewords[_numData + j * _numBlocks + k] = parity[j];
+                }
+            }
+        }
+
+        /*
+         *  Recovers the getNumDataCodewords() bytes of data from the
+         *  final sequence, correcting each block.  pCodewords is not
+         *  changed.  Returns RS_UNCORRECTABLE, with pData unspecified, if
+         *  any block could not be corrected.  Safe to call from several
+         *  threads at once.
+         */
+        RSDecodeStatus decode(const uint8_t *pCodewords, uint8_t *pData)
+        {
+            if (_numBlocks == 0)
+            {
+                return RS_INVALID_LENGTH;
+            }
+
+            std::vector<uint8_t> blocks(getNumCodewords());
+            uint8_t *blockPointers[MAX_BLOCKS];
+            size_t blockLengths[MAX_BLOCKS];
+            RSDecodeStatus results[MAX_BLOCKS];
+
+            uint8_t *pBlock = &blocks[0];
+            for (size_t k = 0; k < _numBlocks; k++)
+            {
+                size_t length = getBlockDataLength(k);
+                for (size_t i = 0; i < length; i++)
+                {
+                    pBlock[i] = pCodewords[i * _numBlocks + k];
+                }
+                for (size_t j = 0; j < _numEcc; j++)
+                {
+                    pBlock[length + j] = pCodewords[_numData + j * _numBlocks + k];
+                }
+
+                blockPointers[k] = pBlock;
+                blockLengths[k] = length + _numEcc;
+                pBlock += length + _numEcc;
+            }
+
+            if (!_pDecoder->decodeBatch(blockPointers, blockLengths, _numBlocks, results, true))
+            {
+                return RS_UNCORRECTABLE;
+            }
+
+            RSDecodeStatus status = RS_NO_ERRORS;
+            for (size_t k = 0; k < _numBlocks; k++)
+            {
+                size_t length = getBlockDataLength(k);
+                for (size_t i = 0; i < length; i++)
+                {
+                    pData[i * _numBlocks + k] = blockPointers[k][i];
+                }
+
+                if (results[k] == RS_CORRECTED)
+                {
+                    status = RS_CORRECTED;
+                }
+            }
+
+            return status;
+        }
+
+    private:
+        DataMatrixCodewords(const DataMatrixCodewords&);
+        DataMatrixCodewords& operator=(const DataMatrixCodewords&);
+
+        static const size_t MAX_BLOCKS = 10;
+        static const size_t MAX_BLOCK_DATA = 175;
+
+        struct SizeEntry
+        {
+            uint8_t     rows;
+            uint8_t     columns;
+            uint16_t    numData;        // in the whole symbol
+            uint8_t     numEcc;         // per block
+            uint8_t     numBlocks;
+        };
+
+        /*
+         *  The ECC 200 symbol sizes, from the Data Matrix specification:
+         *  the square sizes, then the rectangular ones.  An unknown size
+         *  gives the all-zero entry at the end.
+         */
+        static const SizeEntry& tableEntry(size_t rows, size_t columns)
+        {
+            static const SizeEntry TABLE[NUM_SIZES + 1] =
+            {
+                {  10,  10,    3,  5,  1 }, {  12,  12,    5,  7,  1 }, {  14,  14,    8, 10,  1 },
+                {  16,  16,   12, 12,  1 }, {  18,  18,   18, 14,  1 }, {  20,  20,   22, 18,  1 },
+                {  22,  22,   30, 20,  1 }, {  24,  24,   36, 24,  1 }, {  26,  26,   44, 28,  1 },
+                {  32,  32,   62, 36,  1 }, {  36,  36,   86, 42,  1 }, {  40,  40,  114, 48,  1 },
+                {  44,  44,  144, 56,  1 }, {  48,  48,  174, 68,  1 }, {  52,  52,  204, 42,  2 },
+                {  64,  64,  280, 56,  2 }, {  72,  72,  368, 36,  4 }, {  80,  80,  456, 48,  4 },
+                {  88,  88,  576, 56,  4 }, {  96,  96,  696, 68,  4 }, { 104, 104,  816, 56,  6 },
+                { 120, 120, 1050, 68,  6 }, { 132, 132, 1304, 62,  8 }, { 144, 144, 1558, 62, 10 },
+                {   8,  18,    5,  7,  1 }, {   8,  32,   10, 11,  1 }, {  12,  26,   16, 14,  1 },
+                {  12,  36,   22, 18,  1 }, {  16,  36,   32, 24,  1 }, {  16,  48,   49, 28,  1 },
+                {   0,   0,    0,  0,  0 }
+            };
+
+            size_t s = 0;
+            while (s < NUM_SIZES && (TABLE[s].rows != rows || TABLE[s].columns != columns))
+            {
+                s++;
+            }
+
+            return TABLE[s];
+        }
+
+        size_t                                  _rows;
+        size_t                                  _columns;
+        size_t                                  _numBlocks;
+        size_t                                  _numEcc;
+        size_t                                  _numData;
+        std::shared_ptr<const RSTableEncoder>   _pEncoder;
+        std::shared_ptr<RSBatchDecoder<GFDM> >  _pDecoder;
+    };
+}
+
+#endif  // DATAMATRIXCODEWORDS_DOT_H
@@ -17,8 +17,11 @@
 #include <iostream>
 #include "gfprime.h"
 #include "gfprime11.h"
+#include "gfprime929.h"
 #include "gfbinary8.h"
 #include "gfbinary256.h"
+#include "gfbinary256dm.h"
+#include "gfbinaryaztec.h"
 #include "eccCommonUnitTests.h"
 
 using namespace std;
@@ -29,6 +32,8 @@ int main(void)
     gfprimeUnitTests();
     gfpolyUnitTests();
     gfbinaryUnitTests();
+    rsUnitTests();
+    barcodeUnitTests();
 
     cout << "Success\n";
 
@@ -20,6 +20,8 @@
 extern void gfpolyUnitTests(void);
 extern void gfprimeUnitTests(void);
 extern void gfbinaryUnitTests(void);
+extern void rsUnitTests(void);
+extern void barcodeUnitTests(void);
 
 
 
@@ -0,0 +1,133 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef ECCCPUFEATURES_DOT_H
+#define ECCCPUFEATURES_DOT_H
+
+#include <atomic>
+#include <stdint.h>
+
+/*
+ *  Instruction-set specific code is only compiled for x86, 32-bit and
+ *  64-bit alike, where every compiler we support has the intrinsics -
+ *  including the Win32 configurations of the Visual Studio projects.
+ *  It only uses intrinsics that exist in both modes.  Everything else
+ *  uses the portable code paths.
+ */
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#define ECC_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/*
+ *  gcc and clang only allow intrinsics inside functions compiled for the
+ *  instruction set, so functions using them are marked with the
+ *  features they need.  Visual Studio allows them anywhere.
+ */
+#if defined(__GNUC__)
+#define ECC_TARGET(features) __attribute__((target(features)))
+#else
+#define ECC_TARGET(features)
+#endif
+
+namespace SilverBayTech
+{
+    /*
+     *  Storage for EccCpuFeatures.  It is a template only so that its
+     *  static members can be defined in this header.
+     */
+    template<typename Unused>
+    struct EccCpuFeatureBits
+    {
+        static std::atomic<uint64_t>    s_bits;
+        static std::atomic<bool>        s_known;
+    };
+
+    template<typename Unused>
+    std::atomic<uint64_t> EccCpuFeatureBits<Unused>::s_bits(0);
+
+    template<typename Unused>
+    std::atomic<bool> EccCpuFeatureBits<Unused>::s_known(false);
+
+    /*
+     *  Run-time checks for optional instructions.  Code built with
+     *  ECC_TARGET must only be called once the matching check passes.
+     */
+    class EccCpuFeatures
+    {
+    public:
+        static bool hasPclmul()
+        {
+            return (featureBits() & (1u << 1)) != 0;
+        }
+
+        /*
+         *  Always true for x64, but not for every 32-bit processor.
+         */
+        static bool hasSse2()
+        {
+            return (featureBits() & (static_cast<uint64_t>(1) << (32 + 26))) != 0;
+        }
+
+        static bool hasSsse3()
+        {
+            return (featureBits() & (1u << 9)) != 0;
+        }
+
+    private:
+        /*
+         *  EDX:ECX from CPUID leaf 1, read once and published through
+         *  atomics rather than a function-local static, which VS2012 does
+         *  not initialize thread-safely.  Should two threads race on the
+         *  first call, both store the same value.
+         */
+        static uint64_t featureBits()
+        {
+            typedef EccCpuFeatureBits<void> Bits;
+            if (!Bits::s_known.load())
+            {
+                Bits::s_bits.store(queryFeatureBits());
+                Bits::s_known.store(true);
+            }
+
+            return Bits::s_bits.load();
+        }
+
+        static uint64_t queryFeatureBits()
+        {
+#if defined(ECC_X86) && defined(_MSC_VER)
+            int registers[4];
+            __cpuid(registers, 1);
+            return (static_cast<uint64_t>(static_cast<uint32_t>(registers[3])) << 32) | static_cast<uint32_t>(registers[2]);
+#elif defined(ECC_X86)
+            unsigned int eax, ebx, ecx, edx;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+            {
+                return 0;
+            }
+            return (static_cast<uint64_t>(edx) << 32) | ecx;
+#else
+            return 0;
+#endif
+        }
+    };
+}
+
+#endif  // ECCCPUFEATURES_DOT_H
@@ -0,0 +1,335 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef ECCTHREADPOOL_DOT_H
+#define ECCTHREADPOOL_DOT_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stddef.h>
+#include "eccUtils.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  A work-stealing thread pool.  Each worker has its own queue of
+     *  tasks.  A worker takes new work from the back of its own queue
+     *  (the most recently submitted, whose data is likely still in
+     *  cache) and, when that is empty, steals from the front of another
+     *  worker's queue (the oldest, typically the largest piece of a
+     *  divide-and-conquer computation.)  Tasks submitted from a worker
+     *  go on that worker's queue; tasks from other threads are spread
+     *  round-robin.
+     *
+     *  Tasks are usually submitted through an EccTaskGroup, which lets
+     *  the submitting thread wait for them while running queued tasks
+     *  itself, so tasks may safely create and wait for further tasks.
+     */
+    class EccThreadPool
+    {
+    public:
+        typedef std::function<void()> Task;
+
+        /*
+         *  Starts numThreads workers, or one per hardware thread if
+         *  numThreads is zero.
+         */
+        EccThreadPool(size_t numThreads = 0)
+            :   _pending(0),
+                _nextQueue(0),
+                _stopping(false)
+        {
+            if (numThreads == 0)
+            {
+                numThreads = std::thread::hardware_concurrency();
+                if (numThreads == 0)
+                {
+                    numThreads = 1;
+                }
+            }
+
+            for (size_t i = 0; i < numThreads; i++)
+            {
+                _queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue));
+            }
+
+            for (size_t i = 0; i < numThreads; i++)
+            {
+                _threads.push_back(std::thread(&EccThreadPool::workerLoop, this, i));
+            }
+        }
+
+        /*
+         *  Finishes any queued tasks, then stops the workers.
+         */
+        ~EccThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_wakeLock);
+                _stopping = true;
+            }
+            _wake.notify_all();
+
+            for (size_t i = 0; i < _threads.size(); i++)
+            {
+                _threads[i].join();
+            }
+        }
+
+        size_t getNumThreads() const
+        {
+            return _threads.size();
+        }
+
+        void submit(const Task& task)
+        {
+            size_t index;
+            if (currentPool() == this)
+            {
+                index = currentIndex();
+            }
+            else
+            {
+                index = _nextQueue++ % _queues.size();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_wakeLock);
+                _pending++;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_queues[index]->lock);
+                _queues[index]->tasks.push_back(task);
+            }
+            _wake.notify_one();
+        }
+
+        /*
+         *  Runs one queued task on the calling thread, if there is one.
+         *  Used by threads waiting for tasks to finish.
+         */
+        bool runPendingTask()
+        {
+            size_t start = (currentPool() == this) ? currentIndex() : 0;
+
+            Task task;
+            if (!takeTask(start, task))
+            {
+                return false;
+            }
+
+            task();
+            return true;
+        }
+
+        /*
+         *  The pool whose worker is running on this thread, if any.
+         */
+        static EccThreadPool *currentPool()
+        {
+            return currentPoolSlot();
+        }
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex          lock;
+            std::deque<Task>    tasks;
+        };
+
+        EccThreadPool(const EccThreadPool&);
+        EccThreadPool& operator=(const EccThreadPool&);
+
+        static EccThreadPool *& currentPoolSlot()
+        {
+            static ECC_THREAD_LOCAL EccThreadPool *s_pPool = 0;
+            return s_pPool;
+        }
+
+        static size_t& currentIndex()
+        {
+            static ECC_THREAD_LOCAL size_t s_index = 0;
+            return s_index;
+        }
+
+        /*
+         *  Takes the newest task from queue "own", or failing that steals
+         *  the oldest task from one of the others.
+         */
+        bool takeTask(size_t own, Task& task)
+        {
+            {
+                WorkerQueue& queue = *_queues[own];
+                std::lock_guard<std::mutex> lock(queue.lock);
+                if (!queue.tasks.empty())
+                {
+                    task = queue.tasks.back();
+                    queue.tasks.pop_back();
+                    _pending--;
+                    return true;
+                }
+            }
+
+            for (size_t offset = 1; offset < _queues.size(); offset++)
+            {
+                WorkerQueue& queue = *_queues[(own + offset) % _queues.size()];
+                std::lock_guard<std::mutex> lock(queue.lock);
+                if (!queue.tasks.empty())
+                {
+                    task = queue.tasks.front();
+                    queue.tasks.pop_front();
+                    _pending--;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void workerLoop(size_t index)
+        {
+            currentPoolSlot() = this;
+            currentIndex() = index;
+
+            for (;;)
+            {
+                Task task;
+                if (takeTask(index, task))
+                {
+                    task();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(_wakeLock);
+                while (_pending == 0 && !_stopping)
+                {
+                    _wake.wait(lock);
+                }
+
+                if (_pending == 0 && _stopping)
+                {
+                    return;
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<WorkerQueue> >  _queues;
+        std::vector<std::thread>                    _threads;
+        std::mutex                                  _wakeLock;
+        std::condition_variable                     _wake;
+        std::atomic<size_t>                         _pending;
+        std::atomic<size_t>                         _nextQueue;
+        bool                                        _stopping;
+    };
+
+    /*
+     *  A set of tasks to be run on a pool and waited for together:
+     *
+     *      EccTaskGroup group(pool);
+     *      group.run(firstHalf);
+     *      secondHalf();           // meanwhile, on this thread
+     *      group.wait();
+     *
+     *  While waiting, the thread runs queued tasks.  Once none are left
+     *  to run, the group's remaining tasks are running on other threads,
+     *  and it sleeps until the last of them finishes.
+     */
+    class EccTaskGroup
+    {
+    public:
+        EccTaskGroup(EccThreadPool& pool)
+            :   _pool(pool),
+                _outstanding(0)
+        {
+        }
+
+        ~EccTaskGroup()
+        {
+            wait();
+        }
+
+        void run(const EccThreadPool::Task& task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                _outstanding++;
+            }
+
+            EccTaskGroup *pGroup = this;
+            _pool.submit([task, pGroup]()
+            {
+                task();
+                pGroup->taskFinished();
+            });
+        }
+
+        void wait()
+        {
+            for (;;)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_lock);
+                    if (_outstanding == 0)
+                    {
+                        return;
+                    }
+                }
+
+                if (!_pool.runPendingTask())
+                {
+                    std::unique_lock<std::mutex> lock(_lock);
+                    while (_outstanding != 0)
+                    {
+                        _finished.wait(lock);
+                    }
+                    return;
+                }
+            }
+        }
+
+    private:
+        EccTaskGroup(const EccTaskGroup&);
+        EccTaskGroup& operator=(const EccTaskGroup&);
+
+        /*
+         *  The count only changes under the lock, and wait() only returns
+         *  after taking it, so the last task is done with the group before
+         *  the group can be destroyed.
+         */
+        void taskFinished()
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            if (--_outstanding == 0)
+            {
+                _finished.notify_all();
+            }
+        }
+
+        EccThreadPool&          _pool;
+        std::mutex              _lock;
+        std::condition_variable _finished;
+        size_t                  _outstanding;
+    };
+}
+
+#endif  // ECCTHREADPOOL_DOT_H
@@ -19,4 +19,14 @@
 
 #define ARRAY_LENGTH(x) (sizeof(x)/sizeof((x)[0]))
 
+/*
+ *  Storage class for per-thread variables.  Visual Studio 2012 predates
+ *  the C++11 thread_local keyword.
+ */
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define ECC_THREAD_LOCAL __declspec(thread)
+#else
+#define ECC_THREAD_LOCAL thread_local
+#endif
+
 #endif  // ECCUTILS_DOT_H
@@ -0,0 +1,516 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GF2POLY_DOT_H
+#define GF2POLY_DOT_H
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+#include "eccCpuFeatures.h"
+#include "gfpoly.h"
+
+#if defined(ECC_X86)
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+namespace SilverBayTech
+{
+    /*
+     *  A polynomial over GF(2), packed 64 coefficients to a word, with
+     *  coefficient i in bit (i % 64) of word (i / 64).  This is the
+     *  natural form for binary BCH generators, minimal polynomials and
+     *  CRC polynomials, and uses 1/32 of the memory of the equivalent
+     *  GFPoly.  Addition and subtraction are both XOR.
+     *
+     *  Multiplication works a word at a time, with each 64x64-bit
+     *  carry-less product done by the PCLMULQDQ instruction when the
+     *  processor has it and by a 4-bit table otherwise.  Division uses
+     *  Barrett reduction:  with mu = x^(d+64) / g precomputed from the
+     *  top of the divisor, each step finds the next 64 quotient bits
+     *  with two carry-less multiplies and no trial subtraction.
+     *
+     *  The words are kept trimmed, so the zero polynomial has no words
+     *  and degree -1.
+     */
+    class GF2Poly
+    {
+    public:
+        /*
+         *  Constructor that builds the zero polynomial.
+         */
+        GF2Poly()
+        {
+        }
+
+        /*
+         *  Constructor from the low 64 coefficients, e.g. 0x107 for
+         *  x^8 + x^2 + x + 1.
+         */
+        explicit GF2Poly(uint64_t bits)
+        {
+            if (bits != 0)
+            {
+                _words.push_back(bits);
+            }
+        }
+
+        /*
+         *  Conversion from a polynomial over a binary field whose
+         *  coefficients are all 0 or 1 (such as a minimal polynomial
+         *  computed in GF(2^m).)  Only the low bit of each coefficient
+         *  is used.
+         */
+        template<typename GF, typename Alloc>
+        explicit GF2Poly(const GFPoly<GF, Alloc>& poly)
+        {
+            size_t numCoef = poly.getNumCoef();
+            _words.resize((numCoef + 63) / 64);
+            for (size_t i = 0; i < numCoef; i++)
+            {
+                if (poly[i].toInt() & 1)
+                {
+                    _words[i / 64] |= static_cast<uint64_t>(1) << (i % 64);
+                }
+            }
+            trim();
+        }
+
+        /*
+         *  Conversion to a polynomial over a field containing GF(2), with
+         *  degree() + 1 coefficients (one for the zero polynomial.)
+         */
+        template<typename GF>
+        GFPoly<GF> toGFPoly() const
+        {
+            int thisDegree = degree();
+            GFPoly<GF> output(thisDegree < 0 ? 1 : thisDegree + 1);
+            for (int i = 0; i <= thisDegree; i++)
+            {
+                if (coef(i))
+                {
+                    output[i] = GF(1);
+                }
+            }
+
+            return output;
+        }
+
+        /*
+         *  Degree, or -1 for the zero polynomial.
+         */
+        int degree() const
+        {
+            if (_words.empty())
+            {
+                return -1;
+            }
+
+            uint64_t top = _words.back();
+            int bit = 63;
+            while (((top >> bit) & 1) == 0)
+            {
+                bit--;
+            }
+
+            return static_cast<int>(64 * (_words.size() - 1)) + bit;
+        }
+
+        bool isZero() const
+        {
+            return _words.empty();
+        }
+
+        bool coef(size_t n) const
+        {
+            size_t word = n / 64;
+            return word < _words.size() && ((_words[word] >> (n % 64)) & 1) != 0;
+        }
+
+        void setCoef(size_t n, bool value)
+        {
+            size_t word = n / 64;
+            uint64_t mask = static_cast<uint64_t>(1) << (n % 64);
+            if (value)
+            {
+                if (word >= _words.size())
+                {
+                    _words.resize(word + 1);
+                }
+                _words[word] |= mask;
+            }
+            else if (word < _words.size())
+            {
+                _words[word] &= ~mask;
+                trim();
+            }
+        }
+
+        size_t getNumWords() const
+        {
+            return _words.size();
+        }
+
+        const uint64_t *words() const
+        {
+            return _words.empty() ? 0 : &_words[0];
+        }
+
+        bool operator==(const GF2Poly& other) const
+        {
+            return _words == other._words;
+        }
+
+        bool operator!=(const GF2Poly& other) const
+        {
+            return _words != other._words;
+        }
+
+        GF2Poly& operator+=(const GF2Poly& other)
+        {
+            if (other._words.size() > _words.size())
+            {
+                _words.resize(other._words.size());
+            }
+            for (size_t i = 0; i < other._words.size(); i++)
+            {
+                _words[i] ^= other._words[i];
+            }
+            trim();
+
+            return *this;
+        }
+
+        GF2Poly operator+(const GF2Poly& other) const
+        {
+            GF2Poly output(*this);
+            output += other;
+            return output;
+        }
+
+        GF2Poly operator-(const GF2Poly& other) const
+        {
+            return *this + other;
+        }
+
+        /*
+         *  Multiply by x^n.
+         */
+        GF2Poly operator<<(size_t n) const
+        {
+            GF2Poly output;
+            if (_words.empty())
+            {
+                return output;
+            }
+
+            output._words.resize(_words.size() + n / 64 + 1);
+            xorShifted(&output._words[0], &_words[0], _words.size(), n);
+            output.trim();
+
+            return output;
+        }
+
+        GF2Poly operator*(const GF2Poly& other) const
+        {
+            GF2Poly output;
+            if (_words.empty() || other._words.empty())
+            {
+                return output;
+            }
+
+            output._words.resize(_words.size() + other._words.size());
+            multiplyWords(&_words[0], _words.size(), &other._words[0], other._words.size(), &output._words[0]);
+            output.trim();
+
+            return output;
+        }
+
+        GF2Poly operator/(const GF2Poly& divisor) const
+        {
+            GF2Poly quotient;
+            GF2Poly remainder;
+            divmod(divisor, quotient, remainder);
+
+            return quotient;
+        }
+
+        GF2Poly operator%(const GF2Poly& divisor) const
+        {
+            GF2Poly remainder;
+            divmod(divisor, 0, remainder);
+
+            return remainder;
+        }
+
+        /*
+         *  Divides by a non-zero divisor g of degree d.  Each step takes
+         *  the top 64 bits t of the part of the dividend still at or
+         *  above degree d, computes those 64 quotient bits as
+         *  q = t + (t * mu) / x^64, and subtracts q * g.  The quotient is
+         *  optional; the remainder must not be this polynomial.
+         */
+        void divmod(const GF2Poly& divisor, GF2Poly *pQuotient, GF2Poly& remainder) const
+        {
+            int divisorDegree = divisor.degree();
+            remainder = *this;
+            if (pQuotient != 0)
+            {
+                *pQuotient = GF2Poly();
+            }
+
+            if (divisorDegree == 0)
+            {
+                if (pQuotient != 0)
+                {
+                    *pQuotient = *this;
+                }
+                remainder = GF2Poly();
+                return;
+            }
+
+            if (divisorDegree < 0 || degree() < divisorDegree)
+            {
+                return;
+            }
+
+            size_t d = static_cast<size_t>(divisorDegree);
+            uint64_t muLow = barrettConstant(divisor, d);
+
+            size_t divisorWords = divisor._words.size();
+            std::vector<uint64_t> product(divisorWords + 1);
+            if (pQuotient != 0)
+            {
+                pQuotient->_words.resize((degree() - d) / 64 + 1);
+            }
+
+            int remainderDegree = remainder.degree();
+            while (remainderDegree >= divisorDegree)
+            {
+                size_t top = static_cast<size_t>(remainderDegree);
+                size_t shift = top >= d + 63 ? top - d - 63 : 0;
+                uint64_t t = remainder.extract(shift + d);
+
+                uint64_t lo;
+                uint64_t hi;
+                clmul(t, muLow, lo, hi);
+                uint64_t q = t ^ hi;
+
+                for (size_t i = 0; i < product.size(); i++)
+                {
+                    product[i] = 0;
+                }
+                multiplyWords(&q, 1, &divisor._words[0], divisorWords, &product[0]);
+                xorShifted(&remainder._words[0], &product[0], product.size(), shift, remainder._words.size());
+                remainder.trim();
+
+                if (pQuotient != 0)
+                {
+                    uint64_t qWord = q;
+                    xorShifted(&pQuotient->_words[0], &qWord, 1, shift, pQuotient->_words.size());
+                }
+
+                remainderDegree = remainder.degree();
+            }
+
+            if (pQuotient != 0)
+            {
+                pQuotient->trim();
+            }
+        }
+
+        void divmod(const GF2Poly& divisor, GF2Poly& quotient, GF2Poly& remainder) const
+        {
+            divmod(divisor, &quotient, remainder);
+        }
+
+        /*
+         *  pOutput ^= A * B for word arrays, where pOutput has numA + numB
+         *  words.  Uses PCLMULQDQ if the processor has it.
+         */
+        static void multiplyWords(const uint64_t *pA, size_t numA, const uint64_t *pB, size_t numB, uint64_t *pOutput)
+        {
+#if defined(ECC_X86)
+            if (EccCpuFeatures::hasPclmul())
+            {
+                multiplyWordsPclmul(pA, numA, pB, numB, pOutput);
+                return;
+            }
+#endif
+            multiplyWordsPortable(pA, numA, pB, numB, pOutput);
+        }
+
+        /*
+         *  The same using only portable code.
+         */
+        static void multiplyWordsPortable(const uint64_t *pA, size_t numA, const uint64_t *pB, size_t numB, uint64_t *pOutput)
+        {
+            for (size_t i = 0; i < numA; i++)
+            {
+                uint64_t tableLow[16];
+                uint64_t tableHigh[16];
+                buildTable(pA[i], tableLow, tableHigh);
+
+                for (size_t j = 0; j < numB; j++)
+                {
+                    uint64_t lo;
+                    uint64_t hi;
+                    clmulTable(tableLow, tableHigh, pB[j], lo, hi);
+                    pOutput[i + j] ^= lo;
+                    pOutput[i + j + 1] ^= hi;
+                }
+            }
+        }
+
+        /*
+         *  Carry-less product of two words: a * b = hi * x^64 + lo.
+         */
+        static void clmul(uint64_t a, uint64_t b, uint64_t& lo, uint64_t& hi)
+        {
+            uint64_t product[2] = { 0, 0 };
+            multiplyWords(&a, 1, &b, 1, product);
+            lo = product[0];
+            hi = product[1];
+        }
+
+    private:
+#if defined(ECC_X86)
+        ECC_TARGET("pclmul,sse2")
+        static void multiplyWordsPclmul(const uint64_t *pA, size_t numA, const uint64_t *pB, size_t numB, uint64_t *pOutput)
+        {
+            for (size_t i = 0; i < numA; i++)
+            {
+                __m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(pA + i));
+                for (size_t j = 0; j < numB; j++)
+                {
+                    __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(pB + j));
+                    __m128i product = _mm_clmulepi64_si128(a, b, 0);
+                    __m128i *pSum = reinterpret_cast<__m128i *>(pOutput + i + j);
+                    _mm_storeu_si128(pSum, _mm_xor_si128(_mm_loadu_si128(pSum), product));
+                }
+            }
+        }
+#endif
+
+        /*
+         *  Products of a with each 4-bit polynomial, as 67-bit values.
+         */
+        static void buildTable(uint64_t a, uint64_t *pLow, uint64_t *pHigh)
+        {
+            for (size_t i = 0; i < 16; i++)
+            {
+                pLow[i] = 0;
+                pHigh[i] = 0;
+                for (size_t bit = 0; bit < 4; bit++)
+                {
+                    if ((i >> bit) & 1)
+                    {
+                        pLow[i] ^= a << bit;
+                        pHigh[i] ^= bit == 0 ? 0 : a >> (64 - bit);
+                    }
+                }
+            }
+        }
+
+        /*
+         *  Multiplies the tabulated word by b, four bits of b at a time
+         *  starting from the top.
+         */
+        static void clmulTable(const uint64_t *pLow, const uint64_t *pHigh, uint64_t b, uint64_t& lo, uint64_t& hi)
+        {
+            lo = 0;
+            hi = 0;
+            for (int shift = 60; shift >= 0; shift -= 4)
+            {
+                size_t nibble = static_cast<size_t>((b >> shift) & 15);
+                hi = (hi << 4) | (lo >> 60);
+                lo = (lo << 4) ^ pLow[nibble];
+                hi ^= pHigh[nibble];
+            }
+        }
+
+        /*
+         *  The low 64 bits of mu = x^(d+64) / g (bit 64 is always set.)
+         *  The quotient only depends on the top 65 coefficients of g, so
+         *  this divides x^128 by those, one bit at a time.
+         */
+        static uint64_t barrettConstant(const GF2Poly& divisor, size_t d)
+        {
+            uint64_t topLow = d >= 64 ? divisor.extract(d - 64) : divisor._words[0] << (64 - d);
+
+            uint64_t remainder = topLow;
+            uint64_t mu = 0;
+            for (int bit = 63; bit >= 0; bit--)
+            {
+                uint64_t carry = remainder >> 63;
+                remainder <<= 1;
+                if (carry)
+                {
+                    remainder ^= topLow;
+                    mu |= static_cast<uint64_t>(1) << bit;
+                }
+            }
+
+            return mu;
+        }
+
+        /*
+         *  The 64 coefficients starting at coefficient n.
+         */
+        uint64_t extract(size_t n) const
+        {
+            size_t word = n / 64;
+            size_t bit = n % 64;
+            uint64_t value = word < _words.size() ? _words[word] >> bit : 0;
+            if (bit != 0 && word + 1 < _words.size())
+            {
+                value |= _words[word + 1] << (64 - bit);
+            }
+
+            return value;
+        }
+
+        /*
+         *  pDest ^= pSource * x^shift, writing no more than destCount words.
+         */
+        static void xorShifted(uint64_t *pDest, const uint64_t *pSource, size_t count, size_t shift, size_t destCount = static_cast<size_t>(-1))
+        {
+            size_t wordShift = shift / 64;
+            size_t bitShift = shift % 64;
+            for (size_t i = 0; i < count && i + wordShift < destCount; i++)
+            {
+                pDest[i + wordShift] ^= pSource[i] << bitShift;
+                if (bitShift != 0 && i + wordShift + 1 < destCount)
+                {
+                    pDest[i + wordShift + 1] ^= pSource[i] >> (64 - bitShift);
+                }
+            }
+        }
+
+        void trim()
+        {
+            while (!_words.empty() && _words.back() == 0)
+            {
+                _words.pop_back();
+            }
+        }
+
+        std::vector<uint64_t>   _words;
+    };
+}
+
+#endif  // GF2POLY_DOT_H
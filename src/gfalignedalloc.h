@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFALIGNEDALLOC_DOT_H
+#define GFALIGNEDALLOC_DOT_H
+
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace SilverBayTech
+{
+    /*
+     *  Alignment (in bytes) of owned coefficient storage - one cache line,
+     *  and enough for any SIMD load.
+     */
+    static const size_t GF_STORAGE_ALIGNMENT = 64;
+
+    /*
+     *  A block of at least bytes from the global heap, aligned to
+     *  alignment (a power of two).  The block is obtained with room to
+     *  spare, and the original pointer is kept just below the aligned
+     *  one for gfAlignedFree.
+     */
+    inline void *gfAlignedAllocate(size_t bytes, size_t alignment)
+    {
+        if (alignment < sizeof(void *))
+        {
+            alignment = sizeof(void *);
+        }
+
+        char *pRaw = static_cast<char *>(::operator new(bytes + alignment));
+        uintptr_t address = reinterpret_cast<uintptr_t>(pRaw);
+        char *pAligned = pRaw + (alignment - (address & (alignment - 1)));
+
+        reinterpret_cast<void **>(pAligned)[-1] = pRaw;
+        return pAligned;
+    }
+
+    inline void gfAlignedFree(void *p)
+    {
+        if (p != 0)
+        {
+            ::operator delete(static_cast<void **>(p)[-1]);
+        }
+    }
+
+    /*
+     *  Standard allocator that returns storage aligned to ALIGNMENT bytes
+     *  and padded to a whole number of ALIGNMENT-byte blocks, so SIMD
+     *  code can use aligned loads and may read (but not rely on) a
+     *  partial block past the last element.  This is the default
+     *  allocator for GFPoly.
+     *
+     *  The block comes from gfAlignedAllocate.
+     */
+    template<typename T, size_t ALIGNMENT = GF_STORAGE_ALIGNMENT>
+    class GFAlignedAllocator
+    {
+    public:
+        typedef T               value_type;
+        typedef T*              pointer;
+        typedef const T*        const_pointer;
+        typedef T&              reference;
+        typedef const T&        const_reference;
+        typedef size_t          size_type;
+        typedef ptrdiff_t       difference_type;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef GFAlignedAllocator<U, ALIGNMENT> other;
+        };
+
+        GFAlignedAllocator()
+        {
+        }
+
+        template<typename U>
+        GFAlignedAllocator(const GFAlignedAllocator<U, ALIGNMENT>&)
+        {
+        }
+
+        /*
+         *  Number of bytes actually reserved for count elements.
+         */
+        static size_t paddedSize(size_t count)
+        {
+            size_t bytes = count * sizeof(T);
+            return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+        }
+
+        T *allocate(size_t count, const void * = 0)
+        {
+            return static_cast<T *>(gfAlignedAllocate(paddedSize(count), ALIGNMENT));
+        }
+
+        void deallocate(T *p, size_t)
+        {
+            gfAlignedFree(p);
+        }
+
+        void construct(T *p, const T& value)
+        {
+            new(static_cast<void *>(p)) T(value);
+        }
+
+        void destroy(T *p)
+        {
+            p->~T();
+        }
+
+        T *address(T& value) const
+        {
+            return &value;
+        }
+
+        const T *address(const T& value) const
+        {
+            return &value;
+        }
+
+        size_t max_size() const
+        {
+            return (static_cast<size_t>(-1) - 2 * ALIGNMENT) / sizeof(T);
+        }
+    };
+
+    template<typename T, typename U, size_t ALIGNMENT>
+    bool operator==(const GFAlignedAllocator<T, ALIGNMENT>&, const GFAlignedAllocator<U, ALIGNMENT>&)
+    {
+        return true;
+    }
+
+    template<typename T, typename U, size_t ALIGNMENT>
+    bool operator!=(const GFAlignedAllocator<T, ALIGNMENT>&, const GFAlignedAllocator<U, ALIGNMENT>&)
+    {
+        return false;
+    }
+}
+
+#endif  // GFALIGNEDALLOC_DOT_H
@@ -0,0 +1,283 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFARENA_DOT_H
+#define GFARENA_DOT_H
+
+#include <new>
+#include <stddef.h>
+#include "eccUtils.h"
+#include "gfalignedalloc.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  A simple bump ("arena") allocator.  Allocation just advances a
+     *  pointer through a single block of memory obtained up front, and
+     *  individual deallocations do nothing - all of the memory is
+     *  reclaimed at once by reset().  This suits the many short-lived
+     *  polynomials created while decoding a single codeword.
+     *
+     *  The block itself is aligned to GF_STORAGE_ALIGNMENT, and each
+     *  allocation is aligned by address, not by offset, so it gets the
+     *  alignment it asks for whatever the block's.  If the block is
+     *  exhausted, allocations fall back to aligned blocks from the global
+     *  heap (and are counted, so the arena size can be tuned.)
+     *
+     *  An arena is not thread-safe.  The usual pattern is one arena per
+     *  thread, activated with a GFArenaScope.
+     */
+    class GFArena
+    {
+    public:
+        static const size_t DEFAULT_ALIGNMENT = GF_STORAGE_ALIGNMENT;
+
+        GFArena(size_t capacity)
+            :   _pBuffer(static_cast<char *>(gfAlignedAllocate(capacity, GF_STORAGE_ALIGNMENT))),
+                _capacity(capacity),
+                _used(0),
+                _overflowCount(0)
+        {
+        }
+
+        ~GFArena()
+        {
+            gfAlignedFree(_pBuffer);
+        }
+
+        /*
+         *  The alignment must be a power of two.
+         */
+        void *allocate(size_t bytes, size_t alignment = DEFAULT_ALIGNMENT)
+        {
+            uintptr_t base = reinterpret_cast<uintptr_t>(_pBuffer);
+            size_t start = static_cast<size_t>(((base + _used + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1)) - base);
+            if (start + bytes > _capacity)
+            {
+                _overflowCount++;
+                return gfAlignedAllocate(bytes, alignment);
+            }
+
+            _used = start + bytes;
+            return _pBuffer + start;
+        }
+
+        void deallocate(void *p)
+        {
+            if (!contains(p))
+            {
+                gfAlignedFree(p);
+            }
+        }
+
+        /*
+         *  Reclaims everything allocated from the arena.  Any objects still
+         *  using arena memory must not be used afterwards.
+         */
+        void reset()
+        {
+            _used = 0;
+        }
+
+        bool contains(const void *p) const
+        {
+            const char *pChar = static_cast<const char *>(p);
+            return pChar >= _pBuffer && pChar < _pBuffer + _capacity;
+        }
+
+        size_t getCapacity() const
+        {
+            return _capacity;
+        }
+
+        size_t getUsed() const
+        {
+            return _used;
+        }
+
+        /*
+         *  Number of allocations that did not fit and went to the heap.
+         */
+        size_t getOverflowCount() const
+        {
+            return _overflowCount;
+        }
+
+        /*
+         *  The arena currently active on this thread, if any.
+         */
+        static GFArena *current()
+        {
+            return currentSlot();
+        }
+
+    private:
+        friend class GFArenaScope;
+
+        static GFArena *& currentSlot()
+        {
+            static ECC_THREAD_LOCAL GFArena *s_pCurrent = 0;
+            return s_pCurrent;
+        }
+
+        GFArena(const GFArena&);
+        GFArena& operator=(const GFArena&);
+
+        char    *_pBuffer;
+        size_t  _capacity;
+        size_t  _used;
+        size_t  _overflowCount;
+    };
+
+    /*
+     *  Makes an arena the current one for this thread for the lifetime of
+     *  the scope.  When the scope ends the arena is reset and the previous
+     *  arena (if any) becomes current again.
+     */
+    class GFArenaScope
+    {
+    public:
+        GFArenaScope(GFArena& arena)
+            :   _arena(arena),
+                _pPrevious(GFArena::currentSlot())
+        {
+            GFArena::currentSlot() = &_arena;
+        }
+
+        ~GFArenaScope()
+        {
+            GFArena::currentSlot() = _pPrevious;
+            _arena.reset();
+        }
+
+    private:
+        GFArenaScope(const GFArenaScope&);
+        GFArenaScope& operator=(const GFArenaScope&);
+
+        GFArena&    _arena;
+        GFArena     *_pPrevious;
+    };
+
+    /*
+     *  Standard allocator that draws from the arena that was current on
+     *  this thread when the allocator was created, or from the heap if
+     *  there was none.  For example:
+     *
+     *      typedef GFPoly<GF256, GFArenaAllocator<GF256> > ArenaPoly;
+     *
+     *      GFArenaScope scope(threadArena);
+     *      ArenaPoly syndromes(nsym);     // no heap allocation
+     */
+    template<typename T>
+    class GFArenaAllocator
+    {
+    public:
+        typedef T               value_type;
+        typedef T*              pointer;
+        typedef const T*        const_pointer;
+        typedef T&              reference;
+        typedef const T&        const_reference;
+        typedef size_t          size_type;
+        typedef ptrdiff_t       difference_type;
+
+        template<typename U>
+        struct rebind
+        {
+            typedef GFArenaAllocator<U> other;
+        };
+
+        GFArenaAllocator()
+            :   _pArena(GFArena::current())
+        {
+        }
+
+        template<typename U>
+        GFArenaAllocator(const GFArenaAllocator<U>& other)
+            :   _pArena(other.getArena())
+        {
+        }
+
+        T *allocate(size_t count, const void * = 0)
+        {
+            size_t bytes = count * sizeof(T);
+            if (_pArena != 0)
+            {
+                return static_cast<T *>(_pArena->allocate(bytes));
+            }
+
+            return static_cast<T *>(gfAlignedAllocate(bytes, GFArena::DEFAULT_ALIGNMENT));
+        }
+
+        void deallocate(T *p, size_t)
+        {
+            if (_pArena != 0)
+            {
+                _pArena->deallocate(p);
+            }
+            else
+            {
+                gfAlignedFree(p);
+            }
+        }
+
+        void construct(T *p, const T& value)
+        {
+            new(static_cast<void *>(p)) T(value);
+        }
+
+        void destroy(T *p)
+        {
+            p->~T();
+        }
+
+        T *address(T& value) const
+        {
+            return &value;
+        }
+
+        const T *address(const T& value) const
+        {
+            return &value;
+        }
+
+        size_t max_size() const
+        {
+            return static_cast<size_t>(-1) / sizeof(T);
+        }
+
+        GFArena *getArena() const
+        {
+            return _pArena;
+        }
+
+    private:
+        GFArena *_pArena;
+    };
+
+    template<typename T, typename U>
+    bool operator==(const GFArenaAllocator<T>& one, const GFArenaAllocator<U>& two)
+    {
+        return one.getArena() == two.getArena();
+    }
+
+    template<typename T, typename U>
+    bool operator!=(const GFArenaAllocator<T>& one, const GFArenaAllocator<U>& two)
+    {
+        return one.getArena() != two.getArena();
+    }
+}
+
+#endif  // GFARENA_DOT_H
@@ -21,18 +21,47 @@
 
 namespace SilverBayTech
 {
+    /*
+     *  Element and table storage for GFBinary.  Fields named by their
+     *  polynomial (see below) with at most 2^16 elements use 16 bits,
+     *  which halves the tables - 16K rather than 32K for GF(4096), so
+     *  the log and exp tables of the large Aztec fields stay in the L1
+     *  cache.  Larger fields use 32 bits, and the default fields keep
+     *  the 32-bit tables they were written with.
+     */
+    template<unsigned int SIZE, unsigned int POLYNOMIAL, bool SHORT = (POLYNOMIAL != 0 && SIZE <= 65536u)>
+    struct GFBinaryStorage
+    {
+        typedef uint32_t Type;
+    };
+
+    template<unsigned int SIZE, unsigned int POLYNOMIAL>
+    struct GFBinaryStorage<SIZE, POLYNOMIAL, true>
+    {
+        typedef uint16_t Type;
+    };
+
     /*
      *  A template class that implements a Galois Field with a binary number
      *  of elements using standard XOR arithmetic, plus tables for log
      *  and exp operations.  Those tables must be provided externally - 
      *  the template can't generate them, however the program 
      *  binaryLogExpGenerator can produce the required values.
+     *
+     *  POLYNOMIAL tells apart fields of the same size built on different
+     *  prime polynomials, each with its own tables.  The default, 0, is
+     *  the field of the usual tables for the size (gfbinary256.h for the
+     *  QR Code field); others are named by their polynomial, as in
+     *  GFBinary<256, 0x12D> for Data Matrix (gfbinary256dm.h) and the
+     *  Aztec fields of gfbinaryaztec.h.
      */
 
-    template<unsigned int SIZE>
+    template<unsigned int SIZE, unsigned int POLYNOMIAL = 0>
     class GFBinary
     {
     public:
+        typedef typename GFBinaryStorage<SIZE, POLYNOMIAL>::Type Storage;
+
         /*
          *  Constructor that builds a "zero" element.
          */
@@ -46,22 +75,33 @@ namespace SilverBayTech
          *  The value passed in will be reduced modulo SIZE.
          */
         GFBinary(uint32_t value) 
-            : _value(value % SIZE)
+            : _value(static_cast<Storage>(value % SIZE))
         { 
         }
 
         /*
          *  Copy constructor
          */
-        GFBinary(const GFBinary<SIZE>& other) 
+        GFBinary(const GFBinary<SIZE, POLYNOMIAL>& other) 
             : _value(other._value)
         {
         }
 
+        /*
+         *  Builds the element with a value that is already less than
+         *  SIZE.  Unlike the constructor, the value is not reduced.
+         */
+        static GFBinary<SIZE, POLYNOMIAL> fromReduced(uint32_t value)
+        {
+            GFBinary<SIZE, POLYNOMIAL> output;
+            output._value = static_cast<Storage>(value);
+            return output;
+        }
+
         /*
          *  Assignment operator.
          */
-        GFBinary<SIZE>& operator=(const GFBinary<SIZE>& other) 
+        GFBinary<SIZE, POLYNOMIAL>& operator=(const GFBinary<SIZE, POLYNOMIAL>& other) 
         { 
             if (&other != this) 
             { 
@@ -73,12 +113,12 @@ namespace SilverBayTech
         /*
          *  "Addition-like" operations.
          */
-        GFBinary<SIZE> operator+(const GFBinary<SIZE>& other) const
+        GFBinary<SIZE, POLYNOMIAL> operator+(const GFBinary<SIZE, POLYNOMIAL>& other) const
         { 
-            return GFBinary<SIZE>(_value ^ other._value); 
+            return GFBinary<SIZE, POLYNOMIAL>(_value ^ other._value); 
         }
 
-        GFBinary<SIZE>& operator+=(const GFBinary<SIZE>& other)
+        GFBinary<SIZE, POLYNOMIAL>& operator+=(const GFBinary<SIZE, POLYNOMIAL>& other)
         {
             _value ^= other._value;
             return *this;
@@ -87,12 +127,12 @@ namespace SilverBayTech
         /*
          *  "Subtraction-like" operations.
          */
-        GFBinary<SIZE> operator-(const GFBinary<SIZE>& other) const
+        GFBinary<SIZE, POLYNOMIAL> operator-(const GFBinary<SIZE, POLYNOMIAL>& other) const
         { 
-            return GFBinary<SIZE>(_value ^ other._value); 
+            return GFBinary<SIZE, POLYNOMIAL>(_value ^ other._value); 
         }
 
-        GFBinary<SIZE>& operator-=(const GFBinary<SIZE>& other)
+        GFBinary<SIZE, POLYNOMIAL>& operator-=(const GFBinary<SIZE, POLYNOMIAL>& other)
         {
             _value ^= other._value;
             return *this;
@@ -102,17 +142,17 @@ namespace SilverBayTech
          *  "Multiplication-like" operations.
          */
 
-        GFBinary<SIZE> operator*(const GFBinary<SIZE>& other)  const
+        GFBinary<SIZE, POLYNOMIAL> operator*(const GFBinary<SIZE, POLYNOMIAL>& other)  const
         {
             if (_value == 0 || other._value == 0)
             {
-                return GFBinary<SIZE>(0);
+                return GFBinary<SIZE, POLYNOMIAL>(0);
             }
 
-            return GFBinary<SIZE>::exp(this->log() + other.log());
+            return GFBinary<SIZE, POLYNOMIAL>::exp(this->log() + other.log());
         }
 
-        GFBinary<SIZE>& operator*=(const GFBinary<SIZE>& other)
+        GFBinary<SIZE, POLYNOMIAL>& operator*=(const GFBinary<SIZE, POLYNOMIAL>& other)
         {
             if (_value == 0 || other._value == 0)
             {
@@ -121,7 +161,7 @@ namespace SilverBayTech
             else
             {
                 uint32_t logOfResult = this->log() + other.log();
-                _value = GFBinary<SIZE>::EXP_TABLE[logOfResult % (SIZE - 1)];
+                _value = GFBinary<SIZE, POLYNOMIAL>::EXP_TABLE[logOfResult % (SIZE - 1)];
             }
 
             return *this;
@@ -131,23 +171,23 @@ namespace SilverBayTech
          *  "Division-like" operations.
          */
 
-        GFBinary<SIZE> operator/(const GFBinary<SIZE>& other)  const
+        GFBinary<SIZE, POLYNOMIAL> operator/(const GFBinary<SIZE, POLYNOMIAL>& other)  const
         { 
             if (_value == 0)
             {
-                return GFBinary<SIZE>(0);
+                return GFBinary<SIZE, POLYNOMIAL>(0);
             }
 
             uint32_t logOfResult = SIZE - 1 + this->log() - other.log();
-            return GFBinary<SIZE>::exp(logOfResult);
+            return GFBinary<SIZE, POLYNOMIAL>::exp(logOfResult);
         }
 
-        GFBinary<SIZE>& operator/=(const GFBinary<SIZE>& other)
+        GFBinary<SIZE, POLYNOMIAL>& operator/=(const GFBinary<SIZE, POLYNOMIAL>& other)
         {
             if (_value != 0)
             {
                 uint32_t logOfResult = SIZE - 1 + this->log() - other.log();
-                _value = GFBinary<SIZE>::EXP_TABLE[logOfResult % (SIZE - 1)];
+                _value = GFBinary<SIZE, POLYNOMIAL>::EXP_TABLE[logOfResult % (SIZE - 1)];
             }
 
             return *this;
@@ -156,19 +196,19 @@ namespace SilverBayTech
         /*
          *  Unary negation - returns the additive inverse.
          */
-        GFBinary<SIZE> operator-() const
+        GFBinary<SIZE, POLYNOMIAL> operator-() const
         { 
-            return GFBinary<SIZE>(_value); 
+            return GFBinary<SIZE, POLYNOMIAL>(_value); 
         }
 
         /*
          *  Comparison operations.
          */
-        bool operator==(const GFBinary<SIZE>& other) const
+        bool operator==(const GFBinary<SIZE, POLYNOMIAL>& other) const
         { 
             return _value == other._value; 
         }
-        bool operator!=(const GFBinary<SIZE>& other) const
+        bool operator!=(const GFBinary<SIZE, POLYNOMIAL>& other) const
         { 
             return _value != other._value; 
         }
@@ -186,9 +226,9 @@ namespace SilverBayTech
          *  antilog function.  It depends on the EXP_TABLE[] array,
          *  which has to be declared by the user.
          */
-        static GFBinary<SIZE> exp(uint32_t power)
+        static GFBinary<SIZE, POLYNOMIAL> exp(uint32_t power)
         {
-            return GFBinary<SIZE>(EXP_TABLE[power % (SIZE - 1)]);
+            return GFBinary<SIZE, POLYNOMIAL>(EXP_TABLE[power % (SIZE - 1)]);
         }
 
         /*
@@ -204,18 +244,24 @@ namespace SilverBayTech
         /*
          *  Computes this element to the nth power.
          */
-        GFBinary<SIZE> pow(uint32_t power) const
+        GFBinary<SIZE, POLYNOMIAL> pow(uint32_t power) const
         {
             if (_value == 0)
             {
-                return GFBinary<SIZE>(0);
+                return GFBinary<SIZE, POLYNOMIAL>(0);
             }
 
-            return GFBinary<SIZE>::exp(log() * power);
+            return GFBinary<SIZE, POLYNOMIAL>::exp(log() * power);
         }
 
         static const uint32_t FIELD_SIZE = SIZE;
 
+        /*
+         *  Adding any element to itself gives zero, so the characteristic is 2.
+         *  (Used to reduce integer multiples, e.g. in formal derivatives.)
+         */
+        static const uint32_t CHARACTERISTIC = 2;
+
     private:
         /*
          *  This is the underlying value of an element.  A smaller data type
@@ -229,14 +275,14 @@ namespace SilverBayTech
          *  Alternately, once the EXP and LOG tables are worked out, multiplication
          *  can be re-defined via log and exp.
          */
-        uint32_t _value;
+        Storage _value;
 
-        static const uint32_t EXP_TABLE[];
-        static const uint32_t LOG_TABLE[];
+        static const Storage EXP_TABLE[];
+        static const Storage LOG_TABLE[];
     };
 
-    template<unsigned int SIZE>
-    std::ostream& operator<< (std::ostream& stream, const GFBinary<SIZE>& item)
+    template<unsigned int SIZE, unsigned int POLYNOMIAL>
+    std::ostream& operator<< (std::ostream& stream, const GFBinary<SIZE, POLYNOMIAL>& item)
     {
         ios::fmtflags previousFlags(stream.flags());
         stream << uppercase << hex << item.toInt();
@@ -243,6 +243,21 @@ static void outputToStream(void)
     }
 }
 
+/*
+ *  Fields named by their polynomial use 16-bit storage only when every
+ *  element fits.
+ */
+static void storage_fitsFieldSize(void)
+{
+    assert(sizeof(GFBinary<256>::Storage) == 4);
+    assert(sizeof(GFBinary<4096, 0x1069>::Storage) == 2);
+    assert(sizeof(GFBinary<65536, 0x1002D>::Storage) == 2);
+    assert(sizeof(GFBinary<131072, 0x20009>::Storage) == 4);
+
+    GFBinary<131072, 0x20009> objUnderTest(131071);
+    assert(objUnderTest.toInt() == 131071);
+}
+
 void gfbinaryUnitTests(void)
 {
     zeroArgConstructor_createsZero();
@@ -261,5 +276,6 @@ void gfbinaryUnitTests(void)
     expInverseOfLog();
     powEqualsMultiplication();
     outputToStream();
+    storage_fitsFieldSize();
 }
 
@@ -0,0 +1,422 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFBINARYFFT_DOT_H
+#define GFBINARYFFT_DOT_H
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace SilverBayTech
+{
+    template<unsigned int SIZE, unsigned int POLYNOMIAL> class GFBinary;
+
+    /*
+     *  Additive FFT for a binary field GF(2^M) (Gao and Mateer, "Additive
+     *  Fast Fourier Transforms over Finite Fields", 2010.)  A binary field
+     *  has no multiplicative subgroup of power-of-two size, so the usual
+     *  FFT does not apply.  Instead, this evaluates a polynomial with up
+     *  to 2^m coefficients at every point of the additive subspace
+     *  spanned by the bits 1, 2, 4, ... 2^(m-1) - that is, at the field
+     *  elements 0 ... 2^m - 1, with value i landing in output i - in
+     *  O(n log^2 n) additions and O(n log n) multiplications.
+     *
+     *  Each step of the recursion splits off one basis element b (the
+     *  "pivot"):  after scaling, f(b x) = g0(x^2 + x) + x g1(x^2 + x),
+     *  found by a Taylor expansion at x^2 + x, and since u and u + 1 give
+     *  the same x^2 + x, g0 and g1 only need evaluating on a subspace of
+     *  half the size.  Splitting off the lowest bit first means a
+     *  transform of size 2^m uses a prefix of every table built for the
+     *  largest size, so one set of tables serves all sizes.
+     *
+     *  The inverse transform interpolates, which gives O(n log^2 n)
+     *  multiplication of polynomials whose product has at most 2^M
+     *  coefficients, and evaluate() evaluates at every field element.
+     *
+     *  GF must be a binary field (e.g. GFBinary<256>.)  The tables are
+     *  built once per field, before main() runs, so they must not be used
+     *  from other static initializers.
+     */
+    template<typename GF>
+    class GFBinaryFFT
+    {
+    public:
+        static const GFBinaryFFT<GF>& instance()
+        {
+            return s_instance;
+        }
+
+        /*
+         *  log2 of the largest transform, i.e. M for GF(2^M).
+         */
+        size_t getMaxDimension() const
+        {
+            return _maxDimension;
+        }
+
+        /*
+         *  Replaces the 2^dimension coefficients at pData (lowest exponent
+         *  first) by the polynomial's values at 0 ... 2^dimension - 1.
+         *  pScratch must have room for 2^dimension elements.
+         */
+        void forward(GF *pData, size_t dimension, GF *pScratch) const
+        {
+            forward(pData, dimension, 0, pScratch);
+        }
+
+        /*
+         *  The inverse of forward() - replaces values at 0 ... 2^dimension - 1
+         *  by the coefficients of the polynomial of degree less than
+         *  2^dimension that takes those values.
+         */
+        void inverse(GF *pData, size_t dimension, GF *pScratch) const
+        {
+            inverse(pData, dimension, 0, pScratch);
+        }
+
+        /*
+         *  Smallest dimension whose transform holds numCoef coefficients.
+         */
+        static size_t dimensionFor(size_t numCoef)
+        {
+            size_t dimension = 0;
+            while ((static_cast<size_t>(1) << dimension) < numCoef)
+            {
+                dimension++;
+            }
+
+            return dimension;
+        }
+
+        /*
+         *  Computes pOutput += A * B, where numA + numB - 1 must not exceed
+         *  the field size.  pScratch must have room for 3 * 2^d elements,
+         *  where d = dimensionFor(numA + numB - 1).
+         */
+        void multiplyAdd(const GF *pA, size_t numA, const GF *pB, size_t numB, GF *pOutput, GF *pScratch) const
+        {
+            size_t outputCount = numA + numB - 1;
+            size_t dimension = dimensionFor(outputCount);
+            size_t size = static_cast<size_t>(1) << dimension;
+
+            GF *pTransformA = pScratch;
+            GF *pTransformB = pTransformA + size;
+            GF *pWork = pTransformB + size;
+
+            load(pTransformA, size, pA, numA);
+            load(pTransformB, size, pB, numB);
+
+            forward(pTransformA, dimension, 0, pWork);
+            forward(pTransformB, dimension, 0, pWork);
+            for (size_t i = 0; i < size; i++)
+            {
+                pTransformA[i] *= pTransformB[i];
+            }
+            inverse(pTransformA, dimension, 0, pWork);
+
+            for (size_t i = 0; i < outputCount; i++)
+            {
+                pOutput[i] += pTransformA[i];
+            }
+        }
+
+        /*
+         *  Evaluates a polynomial at every element of the field, so that
+         *  pValues[v] is the value at GF(v).  Since x^FIELD_SIZE = x for
+         *  every element, longer polynomials are folded down first.
+         *  pValues and pScratch must each have room for FIELD_SIZE elements.
+         */
+        void evaluate(const GF *pCoef, size_t numCoef, GF *pValues, GF *pScratch) const
+        {
+            size_t size = GF::FIELD_SIZE;
+            for (size_t i = 0; i < size; i++)
+            {
+                pValues[i] = GF(0);
+            }
+
+            for (size_t i = 0; i < numCoef; i++)
+            {
+                size_t exponent = i < size ? i : (i - 1) % (size - 1) + 1;
+                pValues[exponent] += pCoef[i];
+            }
+
+            forward(pValues, _maxDimension, 0, pScratch);
+        }
+
+    private:
+        /*
+         *  Per-level tables.  Level k of the recursion evaluates on a
+         *  subspace of dimension (maxDimension - k) or less.  The first
+         *  element of that level's basis is the pivot, and for each of the
+         *  other elements b, with g = b / pivot, the next level's basis
+         *  has g^2 + g.
+         */
+        struct Level
+        {
+            std::vector<GF> powers;          // pivot^i
+            std::vector<GF> inversePowers;   // pivot^-i
+            std::vector<GF> offsets;         // u(i) = sum of bit j of i times g(j+1)
+            bool            unitPivot;
+        };
+
+        GFBinaryFFT()
+            :   _maxDimension(dimensionFor(GF::FIELD_SIZE))
+        {
+            std::vector<GF> basis(_maxDimension);
+            for (size_t j = 0; j < _maxDimension; j++)
+            {
+                basis[j] = GF(static_cast<uint32_t>(1) << j);
+            }
+
+            _levels.resize(_maxDimension);
+            for (size_t k = 0; k < _maxDimension; k++)
+            {
+                Level& level = _levels[k];
+                size_t dimension = basis.size();
+                size_t size = static_cast<size_t>(1) << dimension;
+                GF pivot = basis[0];
+                GF pivotInverse = GF(1) / pivot;
+
+                level.unitPivot = (pivot == GF(1));
+                level.powers.resize(size);
+                level.inversePowers.resize(size);
+                level.powers[0] = GF(1);
+                level.inversePowers[0] = GF(1);
+                for (size_t i = 1; i < size; i++)
+                {
+                    level.powers[i] = level.powers[i - 1] * pivot;
+                    level.inversePowers[i] = level.inversePowers[i - 1] * pivotInverse;
+                }
+
+                std::vector<GF> scaled(dimension - 1);
+                for (size_t j = 1; j < dimension; j++)
+                {
+                    scaled[j - 1] = basis[j] * pivotInverse;
+                }
+
+                level.offsets.resize(size / 2);
+                for (size_t i = 0; i < size / 2; i++)
+                {
+                    GF offset;
+                    for (size_t j = 0; j + 1 < dimension; j++)
+                    {
+                        if ((i >> j) & 1)
+                        {
+                            offset += scaled[j];
+                        }
+                    }
+                    level.offsets[i] = offset;
+                }
+
+                basis.resize(dimension - 1);
+                for (size_t j = 0; j + 1 < dimension; j++)
+                {
+                    basis[j] = scaled[j] * scaled[j] + scaled[j];
+                }
+            }
+        }
+
+        GFBinaryFFT(const GFBinaryFFT<GF>&);
+        GFBinaryFFT<GF>& operator=(const GFBinaryFFT<GF>&);
+
+        static void load(GF *pDest, size_t size, const GF *pSource, size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                pDest[i] = pSource[i];
+            }
+            for (size_t i = count; i < size; i++)
+            {
+                pDest[i] = GF(0);
+            }
+        }
+
+        void forward(GF *pData, size_t dimension, size_t levelIndex, GF *pScratch) const
+        {
+            if (dimension == 0)
+            {
+                return;
+            }
+
+            const Level& level = _levels[levelIndex];
+            size_t size = static_cast<size_t>(1) << dimension;
+            size_t half = size / 2;
+
+            if (!level.unitPivot)
+            {
+                for (size_t i = 1; i < size; i++)
+                {
+                    pData[i] *= level.powers[i];
+                }
+            }
+
+            taylor(pData, size);
+
+            for (size_t i = 0; i < half; i++)
+            {
+                pScratch[i] = pData[2 * i];
+                pScratch[half + i] = pData[2 * i + 1];
+            }
+
+            forward(pScratch, dimension - 1, levelIndex + 1, pData);
+            forward(pScratch + half, dimension - 1, levelIndex + 1, pData);
+
+            for (size_t i = 0; i < half; i++)
+            {
+                GF odd = pScratch[half + i];
+                GF even = pScratch[i] + level.offsets[i] * odd;
+                pData[2 * i] = even;
+                pData[2 * i + 1] = even + odd;
+            }
+        }
+
+        void inverse(GF *pData, size_t dimension, size_t levelIndex, GF *pScratch) const
+        {
+            if (dimension == 0)
+            {
+                return;
+            }
+
+            const Level& level = _levels[levelIndex];
+            size_t size = static_cast<size_t>(1) << dimension;
+            size_t half = size / 2;
+
+            for (size_t i = 0; i < half; i++)
+            {
+                GF odd = pData[2 * i] + pData[2 * i + 1];
+                pScratch[i] = pData[2 * i] + level.offsets[i] * odd;
+                pScratch[half + i] = odd;
+            }
+
+            inverse(pScratch, dimension - 1, levelIndex + 1, pData);
+            inverse(pScratch + half, dimension - 1, levelIndex + 1, pData);
+
+            for (size_t i = 0; i < half; i++)
+            {
+                pData[2 * i] = pScratch[i];
+                pData[2 * i + 1] = pScratch[half + i];
+            }
+
+            inverseTaylor(pData, size);
+
+            if (!level.unitPivot)
+            {
+                for (size_t i = 1; i < size; i++)
+                {
+                    pData[i] *= level.inversePowers[i];
+                }
+            }
+        }
+
+        /*
+         *  Rewrites the size coefficients (size a power of two) in place as
+         *  the Taylor expansion at x^2 + x:  f = sum of (c0 + c1 x)(x^2 + x)^i,
+         *  with digit i stored at positions 2i and 2i + 1.  With t = size / 4,
+         *  (x^2 + x)^t = x^2t + x^t, so f = A + (x^2t + x^t) B is found by
+         *  two passes of additions, and A and B are expanded recursively.
+         */
+        static void taylor(GF *pData, size_t size)
+        {
+            if (size <= 2)
+            {
+                return;
+            }
+
+            size_t quarter = size / 4;
+            for (size_t i = 0; i < quarter; i++)
+            {
+                pData[2 * quarter + i] += pData[3 * quarter + i];
+            }
+            for (size_t i = 0; i < quarter; i++)
+            {
+                pData[quarter + i] += pData[2 * quarter + i];
+            }
+
+            taylor(pData, size / 2);
+            taylor(pData + size / 2, size / 2);
+        }
+
+        static void inverseTaylor(GF *pData, size_t size)
+        {
+            if (size <= 2)
+            {
+                return;
+            }
+
+            inverseTaylor(pData, size / 2);
+            inverseTaylor(pData + size / 2, size / 2);
+
+            size_t quarter = size / 4;
+            for (size_t i = 0; i < quarter; i++)
+            {
+                pData[quarter + i] += pData[2 * quarter + i];
+            }
+            for (size_t i = 0; i < quarter; i++)
+            {
+                pData[2 * quarter + i] += pData[3 * quarter + i];
+            }
+        }
+
+        size_t              _maxDimension;
+        std::vector<Level>  _levels;
+
+        static const GFBinaryFFT<GF> s_instance;
+    };
+
+    template<typename GF>
+    const GFBinaryFFT<GF> GFBinaryFFT<GF>::s_instance;
+
+    /*
+     *  GFBinaryFFT::evaluate for generic code, which may also be built
+     *  for fields that are not binary - there evaluate returns false.
+     *  On success workspace[v] holds the value at GF(v), for every v
+     *  below the field size, and the rest of workspace is scratch.  A
+     *  workspace smaller than WORKSPACE_SIZE is grown, so callers that
+     *  must not allocate while evaluating size it up front.
+     */
+    template<typename GF>
+    struct GFFieldEvaluation
+    {
+        static const size_t WORKSPACE_SIZE = 0;
+
+        static bool evaluate(const GF *, size_t, std::vector<GF>&)
+        {
+            return false;
+        }
+    };
+
+    template<unsigned int SIZE, unsigned int POLYNOMIAL>
+    struct GFFieldEvaluation<GFBinary<SIZE, POLYNOMIAL> >
+    {
+        typedef GFBinary<SIZE, POLYNOMIAL> GF;
+
+        static const size_t WORKSPACE_SIZE = 2 * SIZE;
+
+        static bool evaluate(const GF *pCoef, size_t numCoef, std::vector<GF>& workspace)
+        {
+            if (workspace.size() < WORKSPACE_SIZE)
+            {
+                workspace.resize(WORKSPACE_SIZE);
+            }
+
+            GFBinaryFFT<GF>::instance().evaluate(pCoef, numCoef, &workspace[0], &workspace[SIZE]);
+            return true;
+        }
+    };
+}
+
+#endif  // GFBINARYFFT_DOT_H
@@ -18,21 +18,45 @@
 #define GFPOLY_DOT_H
 
 #include <vector>
+#include <memory>
+#include <utility>
 #include <ostream>
 #include <stdint.h>
+#include "gfpolymul.h"
+#include "gfpolydiv.h"
+#include "gfpolyexpr.h"
+#include "gfalignedalloc.h"
 
 namespace SilverBayTech
 {
-    template<typename GF>
-    class GFPoly
+    /*
+     *  A polynomial with coefficients in the field GF.  Coefficient storage
+     *  comes from Alloc, which by default is cache-line aligned and padded
+     *  for SIMD (see gfalignedalloc.h.)  GFArenaAllocator can be used
+     *  instead to keep the temporary polynomials used while decoding out
+     *  of the global heap - multiplication and division take their
+     *  workspace from the same allocator.  To work on symbols in a
+     *  caller's buffer without copying them, see GFPolyView.
+     *
+     *  Results are built with the allocator of the polynomial they come
+     *  from, and a polynomial keeps its own allocator when assigned to,
+     *  copying the coefficients if the source's storage came from a
+     *  different one.  So a polynomial made outside an arena's scope never
+     *  ends up holding that arena's memory.
+     *
+     *  Shifts, sums, differences and constant multiples are evaluated lazily
+     *  and fused into a single pass on assignment - see gfpolyexpr.h.
+     */
+    template<typename GF, typename Alloc = GFAlignedAllocator<GF> >
+    class GFPoly : public GFPolyExpr<GF, GFPoly<GF, Alloc> >
     {
     public:
         /*
          *  Initializes a polynomial with the specified number of coefficients,
          *  all zero.
          */
-        GFPoly(size_t numCoef = 1)
-            :   _coefficients(numCoef)
+        GFPoly(size_t numCoef = 1, const Alloc& alloc = Alloc())
+            :   _coefficients(numCoef, GF(), alloc)
         {
         }
 
@@ -68,15 +92,39 @@ namespace SilverBayTech
          *  Copy constructor
          */
 
-        GFPoly(const GFPoly<GF>& other)
+        GFPoly(const GFPoly<GF, Alloc>& other)
             :   _coefficients(other._coefficients)
         {
         }
 
+        /*
+         *  Move constructor - takes over the other polynomial's storage.
+         */
+        GFPoly(GFPoly<GF, Alloc>&& other)
+            :   _coefficients(std::move(other._coefficients))
+        {
+        }
+
+        /*
+         *  Evaluates a polynomial expression (see gfpolyexpr.h) in a
+         *  single pass.
+         */
+        template<typename E>
+        GFPoly(const GFPolyExpr<GF, E>& expr, const Alloc& alloc = Alloc())
+            :   _coefficients(expr.self().getNumCoef(), GF(), alloc)
+        {
+            const E& source = expr.self();
+            size_t count = _coefficients.size();
+            for (size_t i = 0; i < count; i++)
+            {
+                _coefficients[i] = source.coef(i);
+            }
+        }
+
         /*
          *  Assignment operator
          */
-        GFPoly<GF>& operator=(const GFPoly<GF>& other)
+        GFPoly<GF, Alloc>& operator=(const GFPoly<GF, Alloc>& other)
         {
             if (this != &other)
             {
@@ -87,54 +135,55 @@ namespace SilverBayTech
         }
 
         /*
-         *  Equality operations.  Two polynomials are equal if all coefficients
-         *  are equal, or if all coefficients of the shorter match the longer and
-         *  all "extra" coefficients of the longer are zero.  (In other words,
-         *  leading zeros do not cause a polynomial to be "different."
+         *  Move assignment takes over the other polynomial's storage if it
+         *  came from an equal allocator, and copies it otherwise.
          */
-
-        bool operator==(const GFPoly<GF>& other) const
+        GFPoly<GF, Alloc>& operator=(GFPoly<GF, Alloc>&& other)
         {
-            if (this == &other)
+            if (this != &other)
             {
-                return true;
+                swap(other);
             }
 
-            const GFPoly<GF> *pLonger = this;
-            const GFPoly<GF> *pShorter = &other;
-            if (pLonger->getNumCoef() < pShorter->getNumCoef())
+            return *this;
+        }
+
+        /*
+         *  Assigns the result of a polynomial expression, writing each
+         *  coefficient in place.  If the expression reads this polynomial
+         *  at a shifted position (e.g. "p = p << 1"), or reads it at all
+         *  when the storage has to grow, the result has to be built in a
+         *  temporary first.
+         */
+        template<typename E>
+        GFPoly<GF, Alloc>& operator=(const GFPolyExpr<GF, E>& expr)
+        {
+            const E& source = expr.self();
+            const GF *pBegin = _coefficients.data();
+            const GF *pEnd = pBegin + _coefficients.size();
+            size_t count = source.getNumCoef();
+
+            if (source.refersToShifted(pBegin, pEnd) || (count > _coefficients.size() && source.refersTo(pBegin, pEnd)))
             {
-                pLonger = &other;
-                pShorter = this;
+                GFPoly<GF, Alloc> temp(expr, getAllocator());
+                _coefficients.swap(temp._coefficients);
+                return *this;
             }
 
-            size_t shorterCount = pShorter->getNumCoef();
-            for (size_t i = 0; i < shorterCount; i++)
+            if (count > _coefficients.size())
             {
-                if (_coefficients[i] != other._coefficients[i])
-                {
-                    return false;
-                }
+                _coefficients.resize(count);
             }
 
-            size_t longerCount = pLonger->getNumCoef();
-            for (size_t i = shorterCount; i < longerCount; i++)
+            for (size_t i = 0; i < count; i++)
             {
-                if (pLonger->_coefficients[i].toInt() != 0)
-                {
-                    return false;
-                }
+                _coefficients[i] = source.coef(i);
             }
 
-            return true;
-        }
-
-        bool operator!=(const GFPoly<GF>& other) const
-        { 
-            return !(*this == other);
+            _coefficients.resize(count);
+            return *this;
         }
 
-
         /*
          *  Subscript operations - returns the appropriate coefficient.
          *  Caller is responsible for not "going off the end."
@@ -158,106 +207,114 @@ namespace SilverBayTech
         }
 
         /*
-         *  Evaluate the polynomial at the specified value
+         *  Expression interface (see gfpolyexpr.h.)
          */
-        GF eval(const GF& value) const
+        const GF& coef(size_t n) const
         {
-            GF output = (*this)[0];
+            return _coefficients[n];
+        }
 
-            size_t thisCount = getNumCoef();
-            for (size_t i = 1; i < thisCount; i++)
-            {
-                GF coef = (*this)[i];
-                output += coef * value.pow(i);
-            }
+        bool refersTo(const void *pBegin, const void *pEnd) const
+        {
+            const GF *pData = _coefficients.data();
+            return gfRangesOverlap(pData, pData + _coefficients.size(), pBegin, pEnd);
+        }
 
-            return output;
+        bool refersToShifted(const void *, const void *) const
+        {
+            return false;
         }
 
         /*
-         *  Multiply this polynomial by another.
+         *  Change the number of coefficients.  Any new (high-order)
+         *  coefficients are zero.
          */
-        GFPoly<GF> operator *(const GFPoly<GF>& other) const
+        void resize(size_t numCoef)
         {
-            size_t thisCount = getNumCoef();
-            size_t otherCount = other.getNumCoef();
-            size_t outputCount = thisCount + otherCount - 1;
-            GFPoly<GF> output(outputCount);
+            _coefficients.resize(numCoef);
+        }
 
-            for (size_t i = 0; i < thisCount; i++)
+        /*
+         *  Exchange coefficients with another polynomial.  Storage is
+         *  exchanged without copying when the two allocators are equal;
+         *  otherwise each polynomial keeps its allocator and the
+         *  coefficients are copied.
+         */
+        void swap(GFPoly<GF, Alloc>& other)
+        {
+            if (_coefficients.get_allocator() == other._coefficients.get_allocator())
             {
-                GF thisCoef = (*this)[i];
-                for (size_t j = 0; j < otherCount; j++)
-                {
-                    output[i+j] = output[i+j] + thisCoef * other[j];
-                }
+                _coefficients.swap(other._coefficients);
+                return;
             }
 
-            return output;
+            std::vector<GF, Alloc> temp(other._coefficients.begin(), other._coefficients.end(), _coefficients.get_allocator());
+            other._coefficients.assign(_coefficients.begin(), _coefficients.end());
+            _coefficients.swap(temp);
+        }
+
+        /*
+         *  The allocator the coefficients come from.
+         */
+        Alloc getAllocator() const
+        {
+            return _coefficients.get_allocator();
         }
 
         /*
-         *  Multiply this polynomial by a constant, resulting in a new
-         *  polynomial.
+         *  Evaluate the polynomial at the specified value
          */
-        GFPoly<GF> operator *(const GF& value) const
+        GF eval(const GF& value) const
         {
+            GF output = (*this)[0];
+
             size_t thisCount = getNumCoef();
-            GFPoly<GF> output(thisCount);
-            for (size_t i = 0; i < thisCount; i++)
+            for (size_t i = 1; i < thisCount; i++)
             {
-                output[i] = (*this)[i] * value;
+                GF coef = (*this)[i];
+                output += coef * value.pow(i);
             }
 
             return output;
         }
 
         /*
-         *  Shift this polynomial to the left by the specified amount.
-         *  (i.e. equivalent to multiplying by x^n)
+         *  Formal derivative.  The integer multiples i * a(i) are reduced
+         *  modulo the field's characteristic, so in binary fields this
+         *  just keeps the odd-exponent terms.
          */
-        GFPoly<GF> operator <<(size_t n) const
+        GFPoly<GF, Alloc> derivative() const
         {
             size_t thisCount = getNumCoef();
-            GFPoly<GF> output(thisCount + n);
-            for (size_t i = 0; i < thisCount; i++)
+            if (thisCount < 2)
             {
-                output[i+n] = (*this)[i];
+                return GFPoly<GF, Alloc>(1, getAllocator());
+            }
+
+            GFPoly<GF, Alloc> output(thisCount - 1, getAllocator());
+            for (size_t i = 1; i < thisCount; i++)
+            {
+                output[i - 1] = GF(static_cast<uint32_t>(i % GF::CHARACTERISTIC)) * (*this)[i];
             }
 
             return output;
         }
 
         /*
-         *  Subtract a polynomial from this one.
+         *  Multiply this polynomial by another.  Large products are done
+         *  using Karatsuba multiplication - see GFPolyMultiplier.  The
+         *  multiplier and its scratch are reused between products - see
+         *  GFPolyMultiplierCache.
          */
-        GFPoly<GF> operator-(const GFPoly<GF>& other) const
+        GFPoly<GF, Alloc> operator *(const GFPoly<GF, Alloc>& other) const
         {
             size_t thisCount = getNumCoef();
             size_t otherCount = other.getNumCoef();
-            size_t outputCount = thisCount;
-            if (otherCount > thisCount)
-            {
-                outputCount = otherCount;
-            }
-
-            GFPoly<GF> output(outputCount);
-            for (size_t i = 0; i < outputCount; i++)
-            {
-                GF thisCoef;
-                if (i < thisCount)
-                {
-                    thisCoef = (*this)[i];
-                }
-
-                GF otherCoef;
-                if (i < otherCount)
-                {
-                    otherCoef = other[i];
-                }
+            size_t outputCount = thisCount + otherCount - 1;
+            GFPoly<GF, Alloc> output(outputCount, getAllocator());
 
-                output[i] = thisCoef - otherCoef;
-            }
+            GFPolyMultiplierCache<GF, Alloc>::multiply(_coefficients.get_allocator(), &_coefficients[0], thisCount,
+                                                       &other._coefficients[0], otherCount, &output[0]);
 
             return output;
         }
@@ -265,40 +322,41 @@ namespace SilverBayTech
         /*
          *  Remainder when this polyomial is divided by another.
          */
-        GFPoly<GF> operator%(const GFPoly<GF>& other) const
+        GFPoly<GF, Alloc> operator%(const GFPoly<GF, Alloc>& other) const
         {
-            GFPoly<GF> dividend(*this);
-            GFPoly<GF> divisor(other);
-            divisor.trimLeadingZeros();
+            GFPoly<GF, Alloc> quotient(1, getAllocator());
+            GFPoly<GF, Alloc> remainder(1, getAllocator());
+            divmod(other, quotient, remainder);
 
-            size_t divisorCoefs = divisor.getNumCoef();
-            size_t dividendCoefs = dividend.getNumCoef();
-
-            GF leadingDivisorCoef = divisor[divisorCoefs - 1];
+            return remainder;
+        }
 
-            if (divisorCoefs <= dividendCoefs)
-            {
-                size_t maxShift = dividendCoefs - divisorCoefs;
+        /*
+         *  Divides this polynomial by another, producing both the quotient
+         *  and the remainder.  Large divisions use a reciprocal computed
+         *  by Newton iteration - see GFPolyDivider.  The quotient and
+         *  remainder must not be this polynomial.
+         */
+        void divmod(const GFPoly<GF, Alloc>& divisor, GFPoly<GF, Alloc>& quotient, GFPoly<GF, Alloc>& remainder) const
+        {
+            GFPolyDivider<GF, Alloc> divider(&divisor._coefficients[0], divisor.getNumCoef(), _coefficients.get_allocator());
+            divmod(divider, quotient, remainder);
+        }
 
-                for (size_t shift = 0; shift <= maxShift; shift++)
-                {
-                    GF factor = dividend[dividendCoefs - 1 - shift];
-                    if (factor.toInt() != 0)
-                    {
-                        factor /= leadingDivisorCoef;
-                        size_t offset = maxShift - shift;
-
-                        for (size_t i = 0; i < divisorCoefs; i++)
-                        {
-                            dividend[i + offset] -= divisor[i] * factor;
-                        }
-                    }
-                }
-            }
+        /*
+         *  Divides this polynomial by a prepared divisor.  Reusing the
+         *  same divider for several dividends avoids recomputing the
+         *  divisor's reciprocal.
+         */
+        template<typename DividerAlloc>
+        void divmod(GFPolyDivider<GF, DividerAlloc>& divider, GFPoly<GF, Alloc>& quotient, GFPoly<GF, Alloc>& remainder) const
+        {
+            size_t thisCount = getNumCoef();
 
-            dividend.trimLeadingZeros(divisorCoefs - 1);
+            quotient._coefficients.resize(divider.getQuotientCoef(thisCount));
+            remainder._coefficients.resize(divider.getRemainderCoef());
 
-            return dividend;
+            divider.divmod(&_coefficients[0], thisCount, &quotient[0], &remainder[0]);
         }
 
         /*
@@ -332,32 +390,19 @@ namespace SilverBayTech
         }
 
     private:
-        std::vector<GF>  _coefficients;
+        std::vector<GF, Alloc>  _coefficients;
     };
 
-    template<typename GF>
-    std::ostream& operator<< (std::ostream& stream, const GFPoly<GF>& poly)
+    /*
+     *  Remainder of a polynomial expression, such as (message << n), divided
+     *  by a polynomial.  The dividend is materialized once, since the
+     *  division needs to work on it anyway.
+     */
+    template<typename GF, typename E, typename Alloc>
+    GFPoly<GF, Alloc> operator%(const GFPolyExpr<GF, E>& dividend, const GFPoly<GF, Alloc>& divisor)
     {
-        size_t size = poly.getNumCoef();
-        for (size_t i = 0; i < size; i++)
-        {
-            size_t exponent = size - i - 1;
-
-            if (i > 0)
-            {
-                stream << '+';
-            }
-            stream << poly[exponent];
-            if (exponent >= 1)
-            {
-                stream << 'x';
-                if (exponent >= 2)
-                {
-                    stream << '^' << exponent;
-                }
-            }
-        }
-        return stream;
+        GFPoly<GF, Alloc> materialized(dividend, divisor.getAllocator());
+        return materialized % divisor;
     }
 }
 #endif  // GFPOLY_DOT_H
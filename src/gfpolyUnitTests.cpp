@@ -15,13 +15,26 @@
  */
 
 #include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
 #include <assert.h>
 #include "eccUtils.h"
 #include "gfpoly.h"
+#include "gfpolyprepared.h"
+#include "gfpolygcd.h"
+#include "gfpolytree.h"
+#include "gfpolyview.h"
+#include "gfarena.h"
+#include "gf2poly.h"
+#include "gfsparsepoly.h"
+#include "eccThreadPool.h"
 #include "gfprime.h"
+#include "gfbinary.h"
 #include "eccCommonUnitTests.h"
 
 using namespace SilverBayTech;
+using namespace std;
 
 static void lengthConstructorTest(void)
 {
@@ -389,6 +402,1190 @@ static void remainder_divisorLarger(void)
     assert(remainder == expected);
 }
 
+/*
+ *  Simple deterministic generator so the larger tests are repeatable.
+ */
+static uint32_t s_randomState = 12345;
+static uint32_t nextRandom(void)
+{
+    s_randomState = s_randomState * 1103515245 + 12345;
+    return s_randomState >> 8;
+}
+
+static GFPoly<GFPrime<11> > randomPoly(size_t numCoef)
+{
+    GFPoly<GFPrime<11> > output(numCoef);
+    for (size_t i = 0; i < numCoef; i++)
+    {
+        output[i] = GFPrime<11>(nextRandom());
+    }
+
+    return output;
+}
+
+static GFPoly<GFPrime<11> > schoolbookProduct(const GFPoly<GFPrime<11> >& one, const GFPoly<GFPrime<11> >& two)
+{
+    GFPoly<GFPrime<11> > output(one.getNumCoef() + two.getNumCoef() - 1);
+    for (size_t i = 0; i < one.getNumCoef(); i++)
+    {
+        for (size_t j = 0; j < two.getNumCoef(); j++)
+        {
+            output[i+j] += one[i] * two[j];
+        }
+    }
+
+    return output;
+}
+
+static const size_t KARATSUBA_SIZES[][2] =
+{
+    { 16, 16 },
+    { 17, 33 },
+    { 64, 64 },
+    { 100, 37 },
+    { 257, 255 },
+    { 1000, 90 },
+};
+
+static void timesPoly_karatsubaMatchesSchoolbook(void)
+{
+    for (size_t i = 0; i < ARRAY_LENGTH(KARATSUBA_SIZES); i++)
+    {
+        GFPoly<GFPrime<11> > input1 = randomPoly(KARATSUBA_SIZES[i][0]);
+        GFPoly<GFPrime<11> > input2 = randomPoly(KARATSUBA_SIZES[i][1]);
+        GFPoly<GFPrime<11> > expected = schoolbookProduct(input1, input2);
+
+        GFPoly<GFPrime<11> > output = input1 * input2;
+
+        assert(output.getNumCoef() == expected.getNumCoef());
+        assert(output == expected);
+        assert(input2 * input1 == expected);
+    }
+}
+
+static void multiplier_reusedAcrossSizes(void)
+{
+    GFPolyMultiplier<GFPrime<11> > multiplier(64);
+
+    for (size_t i = 0; i < ARRAY_LENGTH(KARATSUBA_SIZES); i++)
+    {
+        GFPoly<GFPrime<11> > input1 = randomPoly(KARATSUBA_SIZES[i][0]);
+        GFPoly<GFPrime<11> > input2 = randomPoly(KARATSUBA_SIZES[i][1]);
+        GFPoly<GFPrime<11> > expected = schoolbookProduct(input1, input2);
+        GFPoly<GFPrime<11> > output(expected.getNumCoef());
+
+        multiplier.multiply(&input1[0], input1.getNumCoef(), &input2[0], input2.getNumCoef(), &output[0]);
+
+        assert(output == expected);
+    }
+}
+
+static void divmod_smallQuotientAndRemainder(void)
+{
+    GFPoly<GFPrime<11> > numerator(REMAINDER1, ARRAY_LENGTH(REMAINDER1));
+    GFPoly<GFPrime<11> > denominator(REMAINDER2, ARRAY_LENGTH(REMAINDER2));
+    GFPoly<GFPrime<11> > quotient;
+    GFPoly<GFPrime<11> > remainder;
+
+    numerator.divmod(denominator, quotient, remainder);
+
+    GFPoly<GFPrime<11> > expected(DIVISOR_SMALLER, ARRAY_LENGTH(DIVISOR_SMALLER));
+    assert(remainder == expected);
+    assert(quotient.getNumCoef() == ARRAY_LENGTH(REMAINDER1) - ARRAY_LENGTH(REMAINDER2) + 1);
+    assert(quotient * denominator - numerator == remainder * GFPrime<11>(10));
+}
+
+static const size_t DIVMOD_SIZES[][2] =
+{
+    { 20, 7 },
+    { 200, 60 },
+    { 200, 150 },
+    { 600, 100 },
+    { 1000, 400 },
+};
+
+static void divmod_newtonMatchesDefinition(void)
+{
+    for (size_t i = 0; i < ARRAY_LENGTH(DIVMOD_SIZES); i++)
+    {
+        GFPoly<GFPrime<11> > numerator = randomPoly(DIVMOD_SIZES[i][0]);
+        GFPoly<GFPrime<11> > denominator = randomPoly(DIVMOD_SIZES[i][1]);
+        denominator[DIVMOD_SIZES[i][1] - 1] = GFPrime<11>(7);
+
+        GFPoly<GFPrime<11> > quotient;
+        GFPoly<GFPrime<11> > remainder;
+        numerator.divmod(denominator, quotient, remainder);
+
+        assert(quotient.getNumCoef() == DIVMOD_SIZES[i][0] - DIVMOD_SIZES[i][1] + 1);
+        assert(remainder.getNumCoef() == DIVMOD_SIZES[i][1] - 1);
+
+        GFPoly<GFPrime<11> > rebuilt = quotient * denominator;
+        for (size_t j = 0; j < remainder.getNumCoef(); j++)
+        {
+            rebuilt[j] += remainder[j];
+        }
+        assert(rebuilt == numerator);
+    }
+}
+
+static void divmod_dividerReused(void)
+{
+    GFPoly<GFPrime<11> > denominator = randomPoly(80);
+    denominator[79] = GFPrime<11>(1);
+    GFPolyDivider<GFPrime<11> > divider(&denominator[0], denominator.getNumCoef());
+
+    for (size_t size = 500; size >= 100; size -= 100)
+    {
+        GFPoly<GFPrime<11> > numerator = randomPoly(size);
+        GFPoly<GFPrime<11> > quotient;
+        GFPoly<GFPrime<11> > remainder;
+        numerator.divmod(divider, quotient, remainder);
+
+        assert(remainder == numerator % denominator);
+        assert(quotient * denominator - numerator == remainder * GFPrime<11>(10));
+    }
+}
+
+static void preparedDivisor_matchesRemainder(void)
+{
+    GFPoly<GFPrime<11> > denominator(REMAINDER1, ARRAY_LENGTH(REMAINDER1));
+    PreparedDivisor<GFPrime<11> > objUnderTest(denominator);
+
+    assert(objUnderTest.getDegree() == ARRAY_LENGTH(REMAINDER1) - 1);
+    assert(objUnderTest.getMonic()[objUnderTest.getDegree()].toInt() == 1);
+
+    GFPoly<GFPrime<11> > remainder;
+    for (size_t size = 1; size < 40; size += 3)
+    {
+        GFPoly<GFPrime<11> > numerator = randomPoly(size);
+
+        objUnderTest.remainder(numerator, remainder);
+
+        assert(remainder.getNumCoef() == objUnderTest.getDegree());
+        assert(remainder == numerator % denominator);
+    }
+}
+
+static void preparedDivisor_constantDivisor(void)
+{
+    GFPoly<GFPrime<11> > denominator(DIVISOR_EQUAL, 1);
+    PreparedDivisor<GFPrime<11> > objUnderTest(denominator);
+    GFPoly<GFPrime<11> > numerator(REMAINDER1, ARRAY_LENGTH(REMAINDER1));
+    GFPoly<GFPrime<11> > remainder;
+
+    objUnderTest.remainder(numerator, remainder);
+
+    GFPoly<GFPrime<11> > expected(ZERO, ARRAY_LENGTH(ZERO));
+    assert(remainder == expected);
+}
+
+static const uint32_t ADD_OUTPUT[] = { 1, 3, 5 };
+static void add_differentLength(void)
+{
+    GFPoly<GFPrime<11> > top(SUBTRACT_INPUT1, ARRAY_LENGTH(SUBTRACT_INPUT1));
+    GFPoly<GFPrime<11> > bottom(SUBTRACT_INPUT3, ARRAY_LENGTH(SUBTRACT_INPUT3));
+    GFPoly<GFPrime<11> > expected(ADD_OUTPUT, ARRAY_LENGTH(ADD_OUTPUT));
+
+    GFPoly<GFPrime<11> > output = top + bottom;
+
+    assert(output == expected);
+    assert(bottom + top == expected);
+}
+
+static void expression_fusedMatchesStepwise(void)
+{
+    GFPoly<GFPrime<11> > message(REMAINDER1, ARRAY_LENGTH(REMAINDER1));
+    GFPoly<GFPrime<11> > generator(REMAINDER2, ARRAY_LENGTH(REMAINDER2));
+
+    GFPoly<GFPrime<11> > shifted = message << 2;
+    GFPoly<GFPrime<11> > remainder = shifted % generator;
+    GFPoly<GFPrime<11> > scaled = remainder * GFPrime<11>(3);
+    GFPoly<GFPrime<11> > expected = shifted - scaled;
+
+    GFPoly<GFPrime<11> > output = (message << 2) - ((message << 2) % generator) * GFPrime<11>(3);
+
+    assert(output.getNumCoef() == expected.getNumCoef());
+    assert(output == expected);
+    assert((message << 2) - remainder * GFPrime<11>(3) == expected);
+    assert((message << 2) != expected);
+}
+
+static void expression_assignInPlace(void)
+{
+    GFPoly<GFPrime<11> > objUnderTest(SUBTRACT_INPUT1, ARRAY_LENGTH(SUBTRACT_INPUT1));
+    GFPoly<GFPrime<11> > other(SUBTRACT_INPUT2, ARRAY_LENGTH(SUBTRACT_INPUT2));
+    GFPoly<GFPrime<11> > expected(SUBTRACT_EQUAL_LENGTH, ARRAY_LENGTH(SUBTRACT_EQUAL_LENGTH));
+    const GFPrime<11> *pStorage = &objUnderTest[0];
+
+    objUnderTest = objUnderTest - other;
+
+    assert(objUnderTest == expected);
+    assert(&objUnderTest[0] == pStorage);
+}
+
+static void expression_assignShiftOfSelf(void)
+{
+    GFPoly<GFPrime<11> > objUnderTest(SHIFT_INPUT, ARRAY_LENGTH(SHIFT_INPUT));
+    GFPoly<GFPrime<11> > expected(SHIFT_OUTPUT, ARRAY_LENGTH(SHIFT_OUTPUT));
+
+    objUnderTest = objUnderTest << 3;
+
+    assert(objUnderTest.getNumCoef() == ARRAY_LENGTH(SHIFT_OUTPUT));
+    assert(objUnderTest == expected);
+
+    objUnderTest = (objUnderTest << 1) + objUnderTest;
+    GFPoly<GFPrime<11> > expected2 = (expected << 1) + expected;
+    assert(objUnderTest == expected2);
+}
+
+static void expression_outputToStream(void)
+{
+    GFPoly<GFPrime<11> > input(SUBTRACT_INPUT3, ARRAY_LENGTH(SUBTRACT_INPUT3));
+
+    ostringstream stream;
+    stream << (input << 1) * GFPrime<11>(2);
+
+    assert(stream.str() == "2x^2+4x+0");
+}
+
+static const size_t GCD_SIZES[][3] =
+{
+    { 5, 3, 1 },
+    { 40, 30, 10 },
+    { 150, 140, 1 },
+    { 300, 120, 60 },
+    { 500, 499, 200 },
+};
+
+static void extendedGcd_bezoutIdentity(void)
+{
+    typedef GFPolyGcd<GFPrime<11> > Gcd;
+
+    for (size_t i = 0; i < ARRAY_LENGTH(GCD_SIZES); i++)
+    {
+        GFPoly<GFPrime<11> > common = randomPoly(GCD_SIZES[i][2]);
+        common[GCD_SIZES[i][2] - 1] = GFPrime<11>(3);
+        GFPoly<GFPrime<11> > a = randomPoly(GCD_SIZES[i][0]) * common;
+        GFPoly<GFPrime<11> > b = randomPoly(GCD_SIZES[i][1]) * common;
+
+        GFPoly<GFPrime<11> > gcd;
+        GFPoly<GFPrime<11> > s;
+        GFPoly<GFPrime<11> > t;
+        Gcd::extendedGcd(a, b, gcd, s, t);
+
+        int gcdDegree = Gcd::degree(gcd);
+        assert(gcdDegree >= Gcd::degree(common));
+        assert(gcd[gcdDegree].toInt() == 1);
+        assert(s * a + t * b == gcd);
+        assert(a % gcd == GFPoly<GFPrime<11> >());
+        assert(b % gcd == GFPoly<GFPrime<11> >());
+        assert(common % gcd == GFPoly<GFPrime<11> >() || gcdDegree > Gcd::degree(common));
+    }
+}
+
+static void extendedGcd_zeroInput(void)
+{
+    GFPoly<GFPrime<11> > zero;
+    GFPoly<GFPrime<11> > b(REMAINDER1, ARRAY_LENGTH(REMAINDER1));
+    GFPoly<GFPrime<11> > gcd;
+    GFPoly<GFPrime<11> > s;
+    GFPoly<GFPrime<11> > t;
+
+    GFPolyGcd<GFPrime<11> >::extendedGcd(zero, b, gcd, s, t);
+
+    assert(gcd == b * (GFPrime<11>(1) / b[b.getNumCoef() - 1]));
+    assert(t * b == gcd);
+}
+
+/*
+ *  Reference for partialGcd - classic Euclid, one division per step.
+ */
+static void classicPartialGcd(const GFPoly<GFPrime<11> >& a, const GFPoly<GFPrime<11> >& b, int stopDegree,
+                              GFPoly<GFPrime<11> >& r, GFPoly<GFPrime<11> >& s, GFPoly<GFPrime<11> >& t)
+{
+    typedef GFPolyGcd<GFPrime<11> > Gcd;
+
+    GFPoly<GFPrime<11> > r0(a);
+    GFPoly<GFPrime<11> > s0;
+    GFPoly<GFPrime<11> > t0;
+    r = b;
+    s = GFPoly<GFPrime<11> >();
+    t = GFPoly<GFPrime<11> >();
+    s0[0] = GFPrime<11>(1);
+    t[0] = GFPrime<11>(1);
+
+    while (Gcd::degree(r) >= stopDegree && Gcd::degree(r) >= 0)
+    {
+        GFPoly<GFPrime<11> > quotient;
+        GFPoly<GFPrime<11> > remainder;
+        r0.divmod(r, quotient, remainder);
+
+        GFPoly<GFPrime<11> > nextS = s0 - quotient * s;
+        GFPoly<GFPrime<11> > nextT = t0 - quotient * t;
+        r0 = r;
+        s0 = s;
+        t0 = t;
+        r = remainder;
+        s = nextS;
+        t = nextT;
+    }
+}
+
+static void partialGcd_matchesClassicEuclid(void)
+{
+    static const int CHECK_SYMBOLS[] = { 4, 10, 64, 100, 250 };
+
+    for (size_t i = 0; i < ARRAY_LENGTH(CHECK_SYMBOLS); i++)
+    {
+        int checkSymbols = CHECK_SYMBOLS[i];
+
+        GFPoly<GFPrime<11> > a(2 * checkSymbols + 1);
+        a[2 * checkSymbols] = GFPrime<11>(1);
+        GFPoly<GFPrime<11> > b = randomPoly(2 * checkSymbols);
+
+        GFPoly<GFPrime<11> > r;
+        GFPoly<GFPrime<11> > s;
+        GFPoly<GFPrime<11> > t;
+        GFPolyGcd<GFPrime<11> >::partialGcd(a, b, checkSymbols, r, s, t);
+
+        GFPoly<GFPrime<11> > expectedR;
+        GFPoly<GFPrime<11> > expectedS;
+        GFPoly<GFPrime<11> > expectedT;
+        classicPartialGcd(a, b, checkSymbols, expectedR, expectedS, expectedT);
+
+        assert(GFPolyGcd<GFPrime<11> >::degree(r) < checkSymbols);
+        assert(r == expectedR);
+        assert(s == expectedS);
+        assert(t == expectedT);
+        assert(s * a + t * b == r);
+    }
+}
+
+static void derivativeTest(void)
+{
+    static const uint32_t PRIME_INPUT[] = { 3, 5, 7, 2 };
+    static const uint32_t PRIME_OUTPUT[] = { 9, 10, 7 };
+    GFPoly<GFPrime<11> > prime(PRIME_INPUT, ARRAY_LENGTH(PRIME_INPUT));
+    assert(prime.derivative() == GFPoly<GFPrime<11> >(PRIME_OUTPUT, ARRAY_LENGTH(PRIME_OUTPUT)));
+
+    static const uint32_t BINARY_INPUT[] = { 3, 5, 7, 2 };
+    static const uint32_t BINARY_OUTPUT[] = { 3, 0, 7 };
+    GFPoly<GFBinary<256> > binary(BINARY_INPUT, ARRAY_LENGTH(BINARY_INPUT));
+    assert(binary.derivative() == GFPoly<GFBinary<256> >(BINARY_OUTPUT, ARRAY_LENGTH(BINARY_OUTPUT)));
+}
+
+template<typename GF>
+static void checkTreeEvaluate(size_t numPoints, size_t numCoef)
+{
+    std::vector<GF> points(numPoints);
+    for (size_t i = 0; i < numPoints; i++)
+    {
+        points[i] = GF::exp(static_cast<uint32_t>(i));
+    }
+
+    GFPoly<GF> poly(numCoef);
+    for (size_t i = 0; i < numCoef; i++)
+    {
+        poly[i] = GF(nextRandom());
+    }
+
+    std::vector<GF> values = evaluateAt(poly, points);
+
+    assert(values.size() == numPoints);
+    for (size_t i = 0; i < numPoints; i++)
+    {
+        assert(values[i] == poly.eval(points[i]));
+    }
+}
+
+static void subproductTree_evaluateMatchesEval(void)
+{
+    checkTreeEvaluate<GFPrime<11> >(1, 4);
+    checkTreeEvaluate<GFPrime<11> >(5, 3);
+    checkTreeEvaluate<GFPrime<929> >(300, 500);
+    checkTreeEvaluate<GFPrime<929> >(77, 20);
+    checkTreeEvaluate<GFBinary<256> >(255, 100);
+    checkTreeEvaluate<GFBinary<256> >(63, 30);
+    checkTreeEvaluate<GFBinary<256> >(64, 300);
+}
+
+/*
+ *  points(i) = GF(step * i + 1), which must be distinct.
+ */
+template<typename GF>
+static void checkTreeRoundTrip(size_t numPoints, uint32_t step)
+{
+    std::vector<GF> points(numPoints);
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        points[i] = GF(static_cast<uint32_t>(step * i + 1));
+    }
+
+    GFPolySubproductTree<GF> tree(points);
+    assert(tree.getProduct().getNumCoef() == points.size() + 1);
+    assert(tree.getProduct().eval(points[numPoints / 2]).toInt() == 0);
+
+    for (size_t round = 0; round < 2; round++)
+    {
+        GFPoly<GF> poly(points.size());
+        for (size_t i = 0; i < poly.getNumCoef(); i++)
+        {
+            poly[i] = GF(nextRandom());
+        }
+
+        std::vector<GF> values;
+        tree.evaluate(poly, values);
+
+        GFPoly<GF> output;
+        tree.interpolate(values, output);
+        assert(output == poly);
+    }
+}
+
+static void subproductTree_interpolateRoundTrip(void)
+{
+    checkTreeRoundTrip<GFPrime<929> >(700, 3);
+    checkTreeRoundTrip<GFBinary<256> >(200, 1);
+}
+
+static void interpolate_smallPointSet(void)
+{
+    std::vector<GFBinary<256> > points;
+    std::vector<GFBinary<256> > values;
+    for (uint32_t i = 1; i <= 5; i++)
+    {
+        points.push_back(GFBinary<256>(i * 17));
+        values.push_back(GFBinary<256>(i));
+    }
+
+    GFPoly<GFBinary<256> > output = interpolate(points, values);
+
+    assert(output.getNumCoef() == points.size());
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        assert(output.eval(points[i]) == values[i]);
+    }
+}
+
+static const uint8_t VIEW_BYTES[] = { 0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11 };
+
+static void view_highestFirstMatchesPoly(void)
+{
+    uint32_t symbols[ARRAY_LENGTH(VIEW_BYTES)];
+    for (size_t i = 0; i < ARRAY_LENGTH(VIEW_BYTES); i++)
+    {
+        symbols[i] = VIEW_BYTES[i];
+    }
+    GFPoly<GFBinary<256> > expected(symbols, ARRAY_LENGTH(symbols));
+
+    GFPolyView<GFBinary<256>, const uint8_t> objUnderTest(VIEW_BYTES, ARRAY_LENGTH(VIEW_BYTES));
+
+    assert(objUnderTest.getNumCoef() == expected.getNumCoef());
+    assert(objUnderTest == expected);
+    assert(objUnderTest.eval(GFBinary<256>(2)) == expected.eval(GFBinary<256>(2)));
+    assert(GFPoly<GFBinary<256> >(objUnderTest << 3) == (expected << 3));
+}
+
+static void view_lowestFirstWritable(void)
+{
+    uint16_t buffer[5] = { 0, 0, 0, 0, 0 };
+    GFPolyView<GFPrime<929>, uint16_t> objUnderTest(buffer, ARRAY_LENGTH(buffer), LOWEST_FIRST);
+
+    GFPoly<GFPrime<929> > poly(3);
+    poly[0] = GFPrime<929>(900);
+    poly[1] = GFPrime<929>(5);
+    poly[2] = GFPrime<929>(17);
+
+    objUnderTest = poly * GFPrime<929>(2);
+
+    assert(buffer[0] == 871);
+    assert(buffer[1] == 10);
+    assert(buffer[2] == 34);
+    assert(buffer[3] == 0);
+    assert(buffer[4] == 0);
+
+    objUnderTest = objUnderTest << 1;
+    assert(buffer[0] == 0);
+    assert(buffer[1] == 871);
+    assert(buffer[3] == 34);
+}
+
+/*
+ *  Assigning between two views of overlapping parts of one buffer goes
+ *  through a temporary, so each symbol is read before it is overwritten.
+ */
+static void view_overlappingBuffers(void)
+{
+    uint8_t buffer[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    GFPolyView<GFBinary<256>, uint8_t> low(buffer, 6, LOWEST_FIRST);
+    GFPolyView<GFBinary<256>, uint8_t> high(buffer + 2, 6, LOWEST_FIRST);
+
+    high = low;
+
+    static const uint8_t EXPECTED[] = { 1, 2, 1, 2, 3, 4, 5, 6 };
+    assert(std::equal(buffer, buffer + ARRAY_LENGTH(buffer), EXPECTED));
+
+    GFPolyView<GFBinary<256>, uint8_t> separate(buffer + 6, 2, LOWEST_FIRST);
+    GFPolyView<GFBinary<256>, uint8_t> adjacent(buffer, 6, LOWEST_FIRST);
+    assert(!adjacent.refersTo(separate.data(), separate.data() + 2));
+    assert(high.refersTo(separate.data(), separate.data() + 2));
+}
+
+static void view_encodeInPlace(void)
+{
+    static const size_t PARITY_SYMBOLS = 10;
+
+    GFPoly<GFBinary<256> > generator(1);
+    generator[0] = GFBinary<256>(1);
+    for (uint32_t i = 0; i < PARITY_SYMBOLS; i++)
+    {
+        GFPoly<GFBinary<256> > root(2);
+        root[0] = GFBinary<256>(2).pow(i);
+        root[1] = GFBinary<256>(1);
+        generator = generator * root;
+    }
+    PreparedDivisor<GFBinary<256> > prepared(generator);
+
+    uint8_t codeword[ARRAY_LENGTH(VIEW_BYTES) + PARITY_SYMBOLS];
+    for (size_t i = 0; i < ARRAY_LENGTH(VIEW_BYTES); i++)
+    {
+        codeword[i] = VIEW_BYTES[i];
+    }
+
+    GFPolyView<GFBinary<256>, const uint8_t> message(codeword, ARRAY_LENGTH(VIEW_BYTES));
+    GFPolyView<GFBinary<256>, uint8_t> parity(codeword + ARRAY_LENGTH(VIEW_BYTES), PARITY_SYMBOLS);
+
+    GFPoly<GFBinary<256> > remainder(PARITY_SYMBOLS);
+    prepared.remainder(message << PARITY_SYMBOLS, &remainder[0]);
+    parity = remainder;
+
+    GFPoly<GFBinary<256> > shifted = GFPoly<GFBinary<256> >(message) << PARITY_SYMBOLS;
+    assert(parity == shifted % generator);
+
+    GFPolyView<GFBinary<256>, const uint8_t> received(codeword, ARRAY_LENGTH(codeword));
+    for (uint32_t i = 0; i < PARITY_SYMBOLS; i++)
+    {
+        assert(received.eval(GFBinary<256>(2).pow(i)).toInt() == 0);
+    }
+}
+
+static void alignedStorageTest(void)
+{
+    for (size_t size = 1; size < 100; size += 7)
+    {
+        GFPoly<GFBinary<256> > objUnderTest(size);
+        assert(reinterpret_cast<uintptr_t>(&objUnderTest[0]) % GF_STORAGE_ALIGNMENT == 0);
+    }
+
+    assert(GFAlignedAllocator<GFPrime<929> >::paddedSize(1) == GF_STORAGE_ALIGNMENT);
+    assert(GFAlignedAllocator<GFPrime<929> >::paddedSize(17) == 2 * GF_STORAGE_ALIGNMENT);
+}
+
+static void binaryFFT_evaluateMatchesEval(void)
+{
+    const GFBinaryFFT<GFBinary<256> >& fft = GFBinaryFFT<GFBinary<256> >::instance();
+    assert(fft.getMaxDimension() == 8);
+
+    std::vector<GFBinary<256> > values(256);
+    std::vector<GFBinary<256> > scratch(256);
+
+    static const size_t SIZES[] = { 1, 2, 17, 256, 700 };
+    for (size_t i = 0; i < ARRAY_LENGTH(SIZES); i++)
+    {
+        GFPoly<GFBinary<256> > poly(SIZES[i]);
+        for (size_t j = 0; j < SIZES[i]; j++)
+        {
+            poly[j] = GFBinary<256>(nextRandom());
+        }
+
+        fft.evaluate(&poly[0], poly.getNumCoef(), &values[0], &scratch[0]);
+
+        for (uint32_t x = 0; x < 256; x++)
+        {
+            assert(values[x] == poly.eval(GFBinary<256>(x)));
+        }
+    }
+}
+
+static void binaryFFT_inverseRoundTrip(void)
+{
+    const GFBinaryFFT<GFBinary<256> >& fft = GFBinaryFFT<GFBinary<256> >::instance();
+
+    for (size_t dimension = 0; dimension <= 8; dimension++)
+    {
+        size_t size = static_cast<size_t>(1) << dimension;
+        std::vector<GFBinary<256> > original(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            original[i] = GFBinary<256>(nextRandom());
+        }
+
+        std::vector<GFBinary<256> > data(original);
+        std::vector<GFBinary<256> > scratch(size);
+        fft.forward(&data[0], dimension, &scratch[0]);
+
+        GFPoly<GFBinary<256> > poly(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            poly[i] = original[i];
+        }
+        for (uint32_t x = 0; x < size; x++)
+        {
+            assert(data[x] == poly.eval(GFBinary<256>(x)));
+        }
+
+        fft.inverse(&data[0], dimension, &scratch[0]);
+        assert(data == original);
+    }
+}
+
+static void binaryFFT_multiplyMatchesSchoolbook(void)
+{
+    const GFBinaryFFT<GFBinary<256> >& fft = GFBinaryFFT<GFBinary<256> >::instance();
+
+    static const size_t SIZES[][2] = { { 1, 1 }, { 5, 3 }, { 64, 64 }, { 200, 57 }, { 128, 129 } };
+    for (size_t i = 0; i < ARRAY_LENGTH(SIZES); i++)
+    {
+        std::vector<GFBinary<256> > a(SIZES[i][0]);
+        std::vector<GFBinary<256> > b(SIZES[i][1]);
+        for (size_t j = 0; j < a.size(); j++)
+        {
+            a[j] = GFBinary<256>(nextRandom());
+        }
+        for (size_t j = 0; j < b.size(); j++)
+        {
+            b[j] = GFBinary<256>(nextRandom());
+        }
+
+        size_t outputCount = a.size() + b.size() - 1;
+        std::vector<GFBinary<256> > expected(outputCount);
+        std::vector<GFBinary<256> > output(outputCount);
+        std::vector<GFBinary<256> > scratch(3 * 256);
+
+        GFPolyMultiplier<GFBinary<256> >::schoolbookAdd(&a[0], a.size(), &b[0], b.size(), &expected[0]);
+        fft.multiplyAdd(&a[0], a.size(), &b[0], b.size(), &output[0], &scratch[0]);
+
+        assert(output == expected);
+    }
+}
+
+static void threadPool_nestedTasks(void)
+{
+    EccThreadPool pool(3);
+    std::atomic<size_t> count(0);
+
+    {
+        EccTaskGroup outer(pool);
+        for (size_t i = 0; i < 8; i++)
+        {
+            outer.run([&pool, &count]()
+            {
+                EccTaskGroup inner(pool);
+                for (size_t j = 0; j < 8; j++)
+                {
+                    inner.run([&count]() { count++; });
+                }
+                inner.wait();
+                count++;
+            });
+        }
+        outer.wait();
+    }
+
+    assert(count == 8 * 9);
+}
+
+static void parallelMultiply_matchesSerial(void)
+{
+    static const size_t SIZES[][2] = { {1000, 1000}, {3000, 700}, {257, 1500} };
+    static const size_t THREADS[] = { 1, 2, 4 };
+
+    for (size_t i = 0; i < ARRAY_LENGTH(SIZES); i++)
+    {
+        std::vector<GFPrime<929> > a(SIZES[i][0]);
+        std::vector<GFPrime<929> > b(SIZES[i][1]);
+        for (size_t j = 0; j < a.size(); j++)
+        {
+            a[j] = GFPrime<929>(nextRandom() % 929);
+        }
+        for (size_t j = 0; j < b.size(); j++)
+        {
+            b[j] = GFPrime<929>(nextRandom() % 929);
+        }
+
+        size_t outputCount = a.size() + b.size() - 1;
+        std::vector<GFPrime<929> > expected(outputCount);
+        GFPolyMultiplier<GFPrime<929> > serial;
+        serial.setThreadPool(0);
+        serial.multiply(&a[0], a.size(), &b[0], b.size(), &expected[0]);
+
+        for (size_t t = 0; t < ARRAY_LENGTH(THREADS); t++)
+        {
+            EccThreadPool pool(THREADS[t]);
+            GFPolyMultiplier<GFPrime<929> > parallel;
+            parallel.setThreadPool(&pool, 64);
+
+            std::vector<GFPrime<929> > output(outputCount);
+            parallel.multiply(&a[0], a.size(), &b[0], b.size(), &output[0]);
+            assert(output == expected);
+        }
+    }
+}
+
+static void multiply_cachedAcrossThreads(void)
+{
+    const size_t NUM_PRODUCTS = 16;
+    std::vector<GFPoly<GFPrime<11> > > a;
+    std::vector<GFPoly<GFPrime<11> > > b;
+    std::vector<GFPoly<GFPrime<11> > > output(NUM_PRODUCTS);
+    for (size_t i = 0; i < NUM_PRODUCTS; i++)
+    {
+        a.push_back(randomPoly(40 + 20 * (i % 4)));
+        b.push_back(randomPoly(30 + 10 * i));
+    }
+
+    EccThreadPool pool(4);
+    EccTaskGroup group(pool);
+    for (size_t i = 0; i < NUM_PRODUCTS; i++)
+    {
+        group.run([&a, &b, &output, i]()
+        {
+            output[i] = a[i] * b[i];
+        });
+    }
+    group.wait();
+
+    for (size_t i = 0; i < NUM_PRODUCTS; i++)
+    {
+        assert(output[i] == schoolbookProduct(a[i], b[i]));
+    }
+}
+
+static void parallelMultiply_processWideSetting(void)
+{
+    EccThreadPool pool(2);
+    GFPoly<GFPrime<11> > a = randomPoly(300);
+    GFPoly<GFPrime<11> > b = randomPoly(200);
+    GFPoly<GFPrime<11> > expected = a * b;
+
+    GFPolyParallel::enable(&pool, 32);
+    assert(GFPolyParallel::getPool() == &pool);
+    GFPoly<GFPrime<11> > output = a * b;
+    GFPolyParallel::disable();
+
+    assert(GFPolyParallel::getPool() == 0);
+    assert(output == expected);
+}
+
+static GF2Poly randomGF2Poly(size_t numCoef)
+{
+    GF2Poly output;
+    for (size_t i = 0; i < numCoef; i++)
+    {
+        output.setCoef(i, (nextRandom() & 1) != 0);
+    }
+    output.setCoef(numCoef - 1, true);
+
+    return output;
+}
+
+static void gf2poly_convertRoundTrip(void)
+{
+    static const uint32_t COEF[] = { 1, 0, 0, 0, 1, 1, 1, 0, 1 };   // x^8 + x^4 + x^3 + x^2 + 1
+    GFPoly<GFBinary<256> > poly(COEF, ARRAY_LENGTH(COEF));
+
+    GF2Poly packed(poly);
+    assert(packed == GF2Poly(0x11D));
+    assert(packed.degree() == 8);
+    assert(packed.toGFPoly<GFBinary<256> >() == poly);
+
+    assert(GF2Poly().degree() == -1);
+    assert(GF2Poly(3) * GF2Poly(3) == GF2Poly(5));
+    assert((GF2Poly(1) << 130).degree() == 130);
+}
+
+static void gf2poly_multiplyMatchesGFPoly(void)
+{
+    static const size_t SIZES[][2] = { {1, 1}, {64, 64}, {65, 3}, {300, 129}, {1000, 1000} };
+
+    for (size_t i = 0; i < ARRAY_LENGTH(SIZES); i++)
+    {
+        GF2Poly a = randomGF2Poly(SIZES[i][0]);
+        GF2Poly b = randomGF2Poly(SIZES[i][1]);
+
+        GFPoly<GFBinary<256> > expected = a.toGFPoly<GFBinary<256> >() * b.toGFPoly<GFBinary<256> >();
+        assert(a * b == GF2Poly(expected));
+
+        std::vector<uint64_t> portable(a.getNumWords() + b.getNumWords());
+        GF2Poly::multiplyWordsPortable(a.words(), a.getNumWords(), b.words(), b.getNumWords(), &portable[0]);
+        while (portable.back() == 0)
+        {
+            portable.pop_back();
+        }
+        assert(portable.size() == (a * b).getNumWords());
+        assert(std::equal(portable.begin(), portable.end(), (a * b).words()));
+    }
+}
+
+static void gf2poly_divmodMatchesGFPoly(void)
+{
+    static const size_t SIZES[][2] = { {100, 9}, {500, 64}, {500, 65}, {2000, 300}, {40, 60}, {77, 1} };
+
+    for (size_t i = 0; i < ARRAY_LENGTH(SIZES); i++)
+    {
+        GF2Poly a = randomGF2Poly(SIZES[i][0]);
+        GF2Poly b = randomGF2Poly(SIZES[i][1]);
+
+        GF2Poly quotient;
+        GF2Poly remainder;
+        a.divmod(b, quotient, remainder);
+
+        assert(remainder.degree() < b.degree());
+        assert(quotient * b + remainder == a);
+        assert(a % b == remainder);
+        assert(a / b == quotient);
+
+        GFPoly<GFBinary<256> > expected = a.toGFPoly<GFBinary<256> >() % b.toGFPoly<GFBinary<256> >();
+        assert(remainder == GF2Poly(expected));
+    }
+}
+
+/*
+ *  CRC-8 (polynomial x^8 + x^2 + x + 1, no reflection) of "123456789"
+ *  is the message times x^8 modulo the polynomial.
+ */
+static void gf2poly_crc8CheckValue(void)
+{
+    static const char MESSAGE[] = "123456789";
+    size_t numBits = 8 * (ARRAY_LENGTH(MESSAGE) - 1);
+
+    GF2Poly message;
+    for (size_t i = 0; i < numBits; i++)
+    {
+        if ((MESSAGE[i / 8] >> (7 - i % 8)) & 1)
+        {
+            message.setCoef(numBits - 1 - i, true);
+        }
+    }
+
+    GF2Poly crc = (message << 8) % GF2Poly(0x107);
+    assert(crc == GF2Poly(0xF4));
+}
+
+static GFSparsePoly<GFPrime<929> > randomSparsePoly(size_t degree, size_t numTerms, bool monic)
+{
+    GFSparsePoly<GFPrime<929> > output;
+    for (size_t i = 0; i + 1 < numTerms; i++)
+    {
+        output.addTerm(nextRandom() % degree, GFPrime<929>(nextRandom() % 928 + 1));
+    }
+    output.addTerm(degree, monic ? GFPrime<929>(1) : GFPrime<929>(nextRandom() % 928 + 1));
+
+    return output;
+}
+
+static GFPoly<GFPrime<929> > randomDensePoly(size_t numCoef)
+{
+    GFPoly<GFPrime<929> > output(numCoef);
+    for (size_t i = 0; i < numCoef; i++)
+    {
+        output[i] = GFPrime<929>(nextRandom() % 929);
+    }
+
+    return output;
+}
+
+static void sparse_convertsToAndFromDense(void)
+{
+    static const uint32_t COEF[] = { 3, 0, 0, 0, 0, 7, 0, 1 };   // highest first
+    GFPoly<GFPrime<11> > dense(COEF, ARRAY_LENGTH(COEF));
+
+    GFSparsePoly<GFPrime<11> > sparse(dense);
+    assert(sparse.getNumTerms() == 3);
+    assert(sparse.degree() == 7);
+    assert(sparse.coef(2) == GFPrime<11>(7));
+    assert(sparse.coef(3) == GFPrime<11>(0));
+    assert(sparse == dense);
+    assert(GFPoly<GFPrime<11> >(sparse) == dense);
+    assert(sparse.eval(GFPrime<11>(5)) == dense.eval(GFPrime<11>(5)));
+
+    sparse.addTerm(2, GFPrime<11>(4));
+    assert(sparse.getNumTerms() == 2);
+    sparse.addTerm(4, GFPrime<11>(2));
+    assert(sparse.getNumTerms() == 3);
+    assert(sparse.coef(4) == GFPrime<11>(2));
+}
+
+static void sparse_multiplyMatchesDense(void)
+{
+    for (size_t trial = 0; trial < 4; trial++)
+    {
+        GFSparsePoly<GFPrime<929> > sparse = randomSparsePoly(150 + 40 * trial, 6, false);
+        GFSparsePoly<GFPrime<929> > other = randomSparsePoly(90, 4, false);
+        GFPoly<GFPrime<929> > dense = randomDensePoly(300);
+        GFPoly<GFPrime<929> > sparseDense(sparse);
+
+        assert(sparse * dense == sparseDense * dense);
+        assert(dense * sparse == sparseDense * dense);
+        assert(sparse * other == sparseDense * GFPoly<GFPrime<929> >(other));
+    }
+}
+
+static void sparse_remainderMatchesDense(void)
+{
+    static const size_t DEGREES[] = { 1, 16, 64, 200 };
+
+    for (size_t i = 0; i < ARRAY_LENGTH(DEGREES); i++)
+    {
+        GFSparsePoly<GFPrime<929> > divisor = randomSparsePoly(DEGREES[i], 5, i % 2 == 0);
+        GFPoly<GFPrime<929> > denseDivisor(divisor);
+        GFPoly<GFPrime<929> > message = randomDensePoly(400);
+
+        GFPoly<GFPrime<929> > remainder = (message << DEGREES[i]) % divisor;
+        assert(remainder.getNumCoef() == DEGREES[i]);
+        assert(remainder == (message << DEGREES[i]) % denseDivisor);
+
+        GFPoly<GFPrime<929> > quotient;
+        divmod(message, divisor, quotient, remainder);
+        assert(quotient * denseDivisor + remainder == message);
+    }
+
+    GFPoly<GFPrime<929> > small = randomDensePoly(10);
+    GFSparsePoly<GFPrime<929> > large = randomSparsePoly(40, 3, true);
+    assert(small % large == small);
+}
+
+typedef GFPoly<GFPrime<11>, GFArenaAllocator<GFPrime<11> > > ArenaPoly;
+
+static void arena_polynomialsUseArena(void)
+{
+    GFArena arena(4096);
+    GFPoly<GFPrime<11> > expected = GFPoly<GFPrime<11> >(TIMES_POLY_OUTPUT, ARRAY_LENGTH(TIMES_POLY_OUTPUT)) << 2;
+
+    {
+        GFArenaScope scope(arena);
+        assert(GFArena::current() == &arena);
+
+        ArenaPoly input1(TIMES_INPUT1, ARRAY_LENGTH(TIMES_INPUT1));
+        ArenaPoly input2(TIMES_INPUT2, ARRAY_LENGTH(TIMES_INPUT2));
+        ArenaPoly output = (input1 * input2) << 2;
+
+        assert(arena.getUsed() > 0);
+        assert(arena.contains(&output[0]));
+        assert(output.getNumCoef() == expected.getNumCoef());
+        for (size_t i = 0; i < expected.getNumCoef(); i++)
+        {
+            assert(output[i] == expected[i]);
+        }
+    }
+
+    assert(GFArena::current() == 0);
+    assert(arena.getUsed() == 0);
+    assert(arena.getOverflowCount() == 0);
+}
+
+static void arena_overflowGoesToHeap(void)
+{
+    GFArena arena(64);
+
+    {
+        GFArenaScope scope(arena);
+
+        ArenaPoly small(2);
+        ArenaPoly large(100);
+
+        assert(arena.contains(&small[0]));
+        assert(!arena.contains(&large[0]));
+        assert(arena.getOverflowCount() == 1);
+    }
+
+    ArenaPoly heap(3);
+    assert(!arena.contains(&heap[0]));
+}
+
+/*
+ *  Every allocation, in the block or past it, is aligned however many
+ *  bytes came before it.
+ */
+static void arena_allocationsAreAligned(void)
+{
+    GFArena arena(1024);
+
+    void *pFirst = arena.allocate(3);
+    void *pSecond = arena.allocate(13);
+    void *pThird = arena.allocate(8, 256);
+    void *pOverflow = arena.allocate(2000);
+
+    assert(reinterpret_cast<uintptr_t>(pFirst) % GF_STORAGE_ALIGNMENT == 0);
+    assert(reinterpret_cast<uintptr_t>(pSecond) % GF_STORAGE_ALIGNMENT == 0);
+    assert(reinterpret_cast<uintptr_t>(pThird) % 256 == 0);
+    assert(reinterpret_cast<uintptr_t>(pOverflow) % GF_STORAGE_ALIGNMENT == 0);
+    assert(arena.contains(pThird));
+    assert(!arena.contains(pOverflow));
+    assert(arena.getOverflowCount() == 1);
+    arena.deallocate(pOverflow);
+
+    ArenaPoly heap(5);
+    assert(reinterpret_cast<uintptr_t>(&heap[0]) % GF_STORAGE_ALIGNMENT == 0);
+}
+
+/*
+ *  Arena allocator that counts the bytes requested through it, so a test
+ *  can check that an operation's workspace came from the polynomials'
+ *  allocator.
+ */
+static size_t s_countedBytes = 0;
+
+template<typename T>
+class CountingArenaAllocator : public GFArenaAllocator<T>
+{
+public:
+    template<typename U>
+    struct rebind
+    {
+        typedef CountingArenaAllocator<U> other;
+    };
+
+    CountingArenaAllocator()
+    {
+    }
+
+    template<typename U>
+    CountingArenaAllocator(const CountingArenaAllocator<U>& other)
+        :   GFArenaAllocator<T>(other)
+    {
+    }
+
+    T *allocate(size_t count, const void *pHint = 0)
+    {
+        s_countedBytes += count * sizeof(T);
+        return GFArenaAllocator<T>::allocate(count, pHint);
+    }
+};
+
+/*
+ *  Multiplication and division take their workspace from the
+ *  polynomials' allocator, so within an arena's scope they draw more
+ *  from it than their results need, and do not overflow to the heap.
+ *  The sizes take the Karatsuba and Newton paths.
+ */
+static void arena_productAndRemainderUseArena(void)
+{
+    typedef GFPoly<GFBinary<256>, CountingArenaAllocator<GFBinary<256> > > ArenaPoly256;
+
+    GFPoly<GFBinary<256> > a(200);
+    GFPoly<GFBinary<256> > b(150);
+    GFPoly<GFBinary<256> > r(149);
+    for (size_t i = 0; i < a.getNumCoef(); i++)
+    {
+        a[i] = GFBinary<256>(nextRandom());
+    }
+    for (size_t i = 0; i < b.getNumCoef(); i++)
+    {
+        b[i] = GFBinary<256>(nextRandom());
+    }
+    b[b.getNumCoef() - 1] = GFBinary<256>(1);
+    for (size_t i = 0; i < r.getNumCoef(); i++)
+    {
+        r[i] = GFBinary<256>(nextRandom());
+    }
+    GFPoly<GFBinary<256> > expected = a * b;
+
+    GFArena arena(64 * 1024);
+    {
+        GFArenaScope scope(arena);
+
+        ArenaPoly256 arenaA(a.getNumCoef());
+        ArenaPoly256 arenaB(b.getNumCoef());
+        ArenaPoly256 arenaR(r.getNumCoef());
+        for (size_t i = 0; i < a.getNumCoef(); i++)
+        {
+            arenaA[i] = a[i];
+        }
+        for (size_t i = 0; i < b.getNumCoef(); i++)
+        {
+            arenaB[i] = b[i];
+        }
+        for (size_t i = 0; i < r.getNumCoef(); i++)
+        {
+            arenaR[i] = r[i];
+        }
+
+        s_countedBytes = 0;
+        ArenaPoly256 product = arenaA * arenaB;
+        assert(s_countedBytes > 2 * product.getNumCoef() * sizeof(GFBinary<256>));
+
+        ArenaPoly256 dividend(product);
+        for (size_t i = 0; i < r.getNumCoef(); i++)
+        {
+            dividend[i] += arenaR[i];
+        }
+
+        s_countedBytes = 0;
+        ArenaPoly256 remainder = dividend % arenaB;
+        assert(s_countedBytes > 2 * dividend.getNumCoef() * sizeof(GFBinary<256>));
+        assert(arena.getOverflowCount() == 0);
+
+        assert(arena.contains(&product[0]));
+        assert(product.getNumCoef() == expected.getNumCoef());
+        for (size_t i = 0; i < expected.getNumCoef(); i++)
+        {
+            assert(product[i] == expected[i]);
+        }
+
+        assert(remainder.getNumCoef() == r.getNumCoef());
+        for (size_t i = 0; i < r.getNumCoef(); i++)
+        {
+            assert(remainder[i] == r[i]);
+        }
+    }
+}
+
+/*
+ *  A polynomial made outside an arena's scope keeps heap storage when a
+ *  product is assigned to it inside the scope, whether the product is
+ *  of heap or arena polynomials, so it outlives the arena.
+ */
+static void arena_heapPolyKeepsHeapStorage(void)
+{
+    GFPoly<GFPrime<11> > expected(TIMES_POLY_OUTPUT, ARRAY_LENGTH(TIMES_POLY_OUTPUT));
+    ArenaPoly heapInput1(TIMES_INPUT1, ARRAY_LENGTH(TIMES_INPUT1));
+    ArenaPoly heapInput2(TIMES_INPUT2, ARRAY_LENGTH(TIMES_INPUT2));
+    ArenaPoly fromHeap(4);
+    ArenaPoly fromArena(4);
+    ArenaPoly swapped(4);
+
+    {
+        GFArena arena(4096);
+        GFArenaScope scope(arena);
+
+        fromHeap = heapInput1 * heapInput2;
+        assert(!arena.contains(&fromHeap[0]));
+
+        ArenaPoly arenaInput1(TIMES_INPUT1, ARRAY_LENGTH(TIMES_INPUT1));
+        ArenaPoly arenaInput2(TIMES_INPUT2, ARRAY_LENGTH(TIMES_INPUT2));
+        fromArena = arenaInput1 * arenaInput2;
+        assert(!arena.contains(&fromArena[0]));
+
+        ArenaPoly arenaProduct = arenaInput1 * arenaInput2;
+        assert(arena.contains(&arenaProduct[0]));
+        swapped.swap(arenaProduct);
+        assert(!arena.contains(&swapped[0]));
+        assert(arena.contains(&arenaProduct[0]));
+        assert(arenaProduct.getNumCoef() == 4);
+    }
+
+    assert(fromHeap.getNumCoef() == expected.getNumCoef());
+    assert(fromArena.getNumCoef() == expected.getNumCoef());
+    assert(swapped.getNumCoef() == expected.getNumCoef());
+    for (size_t i = 0; i < expected.getNumCoef(); i++)
+    {
+        assert(fromHeap[i] == expected[i]);
+        assert(fromArena[i] == expected[i]);
+        assert(swapped[i] == expected[i]);
+    }
+}
+
 void gfpolyUnitTests(void)
 {
     lengthConstructorTest();
@@ -403,12 +1600,20 @@ void gfpolyUnitTests(void)
     equalityOperator_differentLengthEqual();
     equalityOperator_differentLengthNotEqual();
     evalTest();
+    derivativeTest();
     timesConstantTest();
     timesPolyTest();
+    timesPoly_karatsubaMatchesSchoolbook();
+    multiplier_reusedAcrossSizes();
     shiftTest();
     subtract_equalLength();
     subtract_topLonger();
     subtract_bottomLonger();
+    add_differentLength();
+    expression_fusedMatchesStepwise();
+    expression_assignInPlace();
+    expression_assignShiftOfSelf();
+    expression_outputToStream();
     trim_notAllZeros();
     trim_allZeros();
     trim_leaveLeadingZeros();
@@ -419,4 +1624,39 @@ void gfpolyUnitTests(void)
     remainder_divisorEqual_remaider();
     remainder_divisorEqual_noRemainder1();
     remainder_divisorEqual_noRemainder2();
+    divmod_smallQuotientAndRemainder();
+    divmod_newtonMatchesDefinition();
+    divmod_dividerReused();
+    preparedDivisor_matchesRemainder();
+    preparedDivisor_constantDivisor();
+    extendedGcd_bezoutIdentity();
+    extendedGcd_zeroInput();
+    partialGcd_matchesClassicEuclid();
+    subproductTree_evaluateMatchesEval();
+    subproductTree_interpolateRoundTrip();
+    interpolate_smallPointSet();
+    view_highestFirstMatchesPoly();
+    view_lowestFirstWritable();
+    view_overlappingBuffers();
+    view_encodeInPlace();
+    alignedStorageTest();
+    binaryFFT_evaluateMatchesEval();
+    binaryFFT_inverseRoundTrip();
+    binaryFFT_multiplyMatchesSchoolbook();
+    threadPool_nestedTasks();
+    parallelMultiply_matchesSerial();
+    multiply_cachedAcrossThreads();
+    parallelMultiply_processWideSetting();
+    gf2poly_convertRoundTrip();
+    gf2poly_multiplyMatchesGFPoly();
+    gf2poly_divmodMatchesGFPoly();
+    gf2poly_crc8CheckValue();
+    sparse_convertsToAndFromDense();
+    sparse_multiplyMatchesDense();
+    sparse_remainderMatchesDense();
+    arena_polynomialsUseArena();
+    arena_overflowGoesToHeap();
+    arena_allocationsAreAligned();
+    arena_productAndRemainderUseArena();
+    arena_heapPolyKeepsHeapStorage();
 }
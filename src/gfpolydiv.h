@@ -0,0 +1,299 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFPOLYDIV_DOT_H
+#define GFPOLYDIV_DOT_H
+
+#include <vector>
+#include <memory>
+#include <stddef.h>
+#include "gfpolymul.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  Tuning parameters for polynomial division.  When both the quotient
+     *  and the divisor have at least NEWTON_THRESHOLD coefficients, the
+     *  quotient is computed by multiplying by a reciprocal of the divisor
+     *  obtained by Newton iteration.  Below that, long division is faster.
+     *  Timing GF(256) and GF(929) divisions of 2n by n coefficients put
+     *  the crossover at about n = 64 for both.
+     */
+    template<typename GF>
+    struct GFPolyDivideTraits
+    {
+        static const size_t NEWTON_THRESHOLD = 64;
+    };
+
+    /*
+     *  Divides polynomials stored as arrays of coefficients (lowest
+     *  exponent first) by a fixed divisor, producing both the quotient
+     *  and the remainder.
+     *
+     *  For large quotients, the divisor is reversed and inverted modulo
+     *  x^k by Newton iteration, which turns the division into two
+     *  multiplications (see "Modern Computer Algebra", section 9.1).
+     *  The reciprocal is kept in the object and extended only when a
+     *  longer quotient is needed, so reusing a divider for the same
+     *  divisor amortizes that work.  The divisor, the reciprocal and all
+     *  of the workspace come from Alloc, as for GFPolyMultiplier.  A
+     *  divider is not thread-safe - use one per thread.
+     */
+    template<typename GF, typename Alloc = std::allocator<GF> >
+    class GFPolyDivider
+    {
+    public:
+        /*
+         *  Prepares to divide by the specified divisor.  Leading zero
+         *  coefficients are ignored.  The divisor must not be zero.
+         */
+        GFPolyDivider(const GF *pDivisor, size_t numCoef, const Alloc& alloc = Alloc())
+            :   _divisor(alloc),
+                _reversed(alloc),
+                _reciprocal(alloc),
+                _work(alloc),
+                _product(alloc),
+                _multiplier(0, alloc)
+        {
+            while (numCoef > 1 && pDivisor[numCoef - 1].toInt() == 0)
+            {
+                numCoef--;
+            }
+
+            _divisor.assign(pDivisor, pDivisor + numCoef);
+            _leadingInverse = GF(1) / _divisor[numCoef - 1];
+        }
+
+        /*
+         *  Number of coefficients in the divisor, after leading zeros
+         *  have been removed.
+         */
+        size_t getNumCoef() const
+        {
+            return _divisor.size();
+        }
+
+        const GF& operator[](size_t n) const
+        {
+            return _divisor[n];
+        }
+
+        /*
+         *  Number of coefficients divmod() writes to the quotient and
+         *  the remainder for a dividend of numDividend coefficients.
+         */
+        size_t getQuotientCoef(size_t numDividend) const
+        {
+            if (numDividend < _divisor.size())
+            {
+                return 1;
+            }
+
+            return numDividend - _divisor.size() + 1;
+        }
+
+        size_t getRemainderCoef() const
+        {
+            if (_divisor.size() < 2)
+            {
+                return 1;
+            }
+
+            return _divisor.size() - 1;
+        }
+
+        /*
+         *  Divides the dividend by the divisor.  pQuotient must have room
+         *  for getQuotientCoef(numDividend) coefficients and pRemainder
+         *  for getRemainderCoef().  Neither may overlap the dividend.
+         */
+        void divmod(const GF *pDividend, size_t numDividend, GF *pQuotient, GF *pRemainder)
+        {
+            size_t divisorCoefs = _divisor.size();
+            size_t remainderCoefs = getRemainderCoef();
+
+            if (numDividend < divisorCoefs)
+            {
+                pQuotient[0] = GF(0);
+                for (size_t i = 0; i < remainderCoefs; i++)
+                {
+                    pRemainder[i] = (i < numDividend) ? pDividend[i] : GF(0);
+                }
+                return;
+            }
+
+            size_t quotientCoefs = numDividend - divisorCoefs + 1;
+            if (quotientCoefs < GFPolyDivideTraits<GF>::NEWTON_THRESHOLD ||
+                divisorCoefs < GFPolyDivideTraits<GF>::NEWTON_THRESHOLD)
+            {
+                longDivision(pDividend, numDividend, pQuotient, pRemainder);
+            }
+            else
+            {
+                newtonDivision(pDividend, numDividend, pQuotient, pRemainder);
+            }
+        }
+
+    private:
+        /*
+         *  Classic long division, O(quotient * divisor).
+         */
+        void longDivision(const GF *pDividend, size_t numDividend, GF *pQuotient, GF *pRemainder)
+        {
+            size_t divisorCoefs = _divisor.size();
+            size_t maxShift = numDividend - divisorCoefs;
+
+            _work.assign(pDividend, pDividend + numDividend);
+
+            for (size_t shift = 0; shift <= maxShift; shift++)
+            {
+                size_t offset = maxShift - shift;
+                GF factor = _work[divisorCoefs - 1 + offset];
+
+                if (factor.toInt() == 0)
+                {
+                    pQuotient[offset] = factor;
+                    continue;
+                }
+
+                factor *= _leadingInverse;
+                pQuotient[offset] = factor;
+
+                for (size_t i = 0; i < divisorCoefs; i++)
+                {
+                    _work[i + offset] -= _divisor[i] * factor;
+                }
+            }
+
+            size_t remainderCoefs = getRemainderCoef();
+            for (size_t i = 0; i < remainderCoefs; i++)
+            {
+                pRemainder[i] = (i < divisorCoefs - 1) ? _work[i] : GF(0);
+            }
+        }
+
+        /*
+         *  With k quotient coefficients and rev() reversing coefficient
+         *  order, rev(quotient) = rev(dividend) * rev(divisor)^-1 mod x^k.
+         *  The remainder then only needs the low coefficients of
+         *  quotient * divisor.
+         */
+        void newtonDivision(const GF *pDividend, size_t numDividend, GF *pQuotient, GF *pRemainder)
+        {
+            size_t divisorCoefs = _divisor.size();
+            size_t quotientCoefs = numDividend - divisorCoefs + 1;
+
+            extendReciprocal(quotientCoefs);
+
+            _work.resize(quotientCoefs);
+            for (size_t i = 0; i < quotientCoefs; i++)
+            {
+                _work[i] = pDividend[numDividend - 1 - i];
+            }
+
+            _product.resize(2 * quotientCoefs - 1);
+            _multiplier.multiply(&_work[0], quotientCoefs, &_reciprocal[0], quotientCoefs, &_product[0]);
+
+            for (size_t i = 0; i < quotientCoefs; i++)
+            {
+                pQuotient[i] = _product[quotientCoefs - 1 - i];
+            }
+
+            size_t remainderCoefs = divisorCoefs - 1;
+            if (remainderCoefs == 0)
+            {
+                pRemainder[0] = GF(0);
+                return;
+            }
+
+            size_t lowQuotientCoefs = quotientCoefs < remainderCoefs ? quotientCoefs : remainderCoefs;
+            _product.resize(lowQuotientCoefs + remainderCoefs - 1);
+            _multiplier.multiply(pQuotient, lowQuotientCoefs, &_divisor[0], remainderCoefs, &_product[0]);
+
+            for (size_t i = 0; i < remainderCoefs; i++)
+            {
+                pRemainder[i] = pDividend[i] - _product[i];
+            }
+        }
+
+        /*
+         *  Makes sure the cached reciprocal of the reversed divisor is good
+         *  to at least "precision" coefficients.  Each Newton step doubles
+         *  the precision:  g' = g - g * (f * g - 1) mod x^2p.  Since
+         *  f * g = 1 mod x^p, only the coefficients of f * g from x^p up
+         *  are needed.
+         */
+        void extendReciprocal(size_t precision)
+        {
+            size_t divisorCoefs = _divisor.size();
+
+            if (_reversed.empty())
+            {
+                _reversed.resize(divisorCoefs);
+                for (size_t i = 0; i < divisorCoefs; i++)
+                {
+                    _reversed[i] = _divisor[divisorCoefs - 1 - i];
+                }
+
+                _reciprocal.resize(1);
+                _reciprocal[0] = _leadingInverse;
+            }
+
+            size_t current = _reciprocal.size();
+            while (current < precision)
+            {
+                size_t next = 2 * current;
+                if (next > precision)
+                {
+                    next = precision;
+                }
+
+                size_t fCoefs = next < divisorCoefs ? next : divisorCoefs;
+                _product.resize(fCoefs + current - 1);
+                _multiplier.multiply(&_reversed[0], fCoefs, &_reciprocal[0], current, &_product[0]);
+
+                size_t deltaCoefs = next - current;
+                _work.resize(deltaCoefs);
+                for (size_t i = 0; i < deltaCoefs; i++)
+                {
+                    size_t index = current + i;
+                    _work[i] = index < _product.size() ? _product[index] : GF(0);
+                }
+
+                _product.resize(2 * deltaCoefs - 1);
+                _multiplier.multiply(&_reciprocal[0], deltaCoefs, &_work[0], deltaCoefs, &_product[0]);
+
+                _reciprocal.resize(next);
+                for (size_t i = 0; i < deltaCoefs; i++)
+                {
+                    _reciprocal[current + i] = -_product[i];
+                }
+
+                current = next;
+            }
+        }
+
+        std::vector<GF, Alloc>          _divisor;
+        GF                              _leadingInverse;
+        std::vector<GF, Alloc>          _reversed;
+        std::vector<GF, Alloc>          _reciprocal;
+        std::vector<GF, Alloc>          _work;
+        std::vector<GF, Alloc>          _product;
+        GFPolyMultiplier<GF, Alloc>     _multiplier;
+    };
+}
+
+#endif  // GFPOLYDIV_DOT_H
@@ -0,0 +1,347 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFPOLYEXPR_DOT_H
+#define GFPOLYEXPR_DOT_H
+
+#include <ostream>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace SilverBayTech
+{
+    /*
+     *  Expression templates for the "cheap" polynomial operations - shift,
+     *  addition, subtraction and multiplication by a constant.  Instead of
+     *  building a temporary polynomial for each operator, the operators
+     *  build a small object describing the computation.  The work is done
+     *  in a single pass when the expression is assigned to a GFPoly, so
+     *
+     *      result = (message << n) - remainder;
+     *
+     *  writes each output coefficient once and allocates nothing beyond
+     *  the result itself.
+     *
+     *  Every expression type E derives from GFPolyExpr<GF, E> and provides:
+     *
+     *      size_t getNumCoef() const;
+     *      GF coef(size_t n) const;        // n < getNumCoef()
+     *      bool refersTo(const void *pBegin, const void *pEnd) const;
+     *      bool refersToShifted(const void *pBegin, const void *pEnd) const;
+     *
+     *  The last two let an assignment detect when the expression reads
+     *  any of the memory [pBegin, pEnd) being assigned to.  Reading the
+     *  same coefficient that is being written is harmless, but reading a
+     *  shifted one is not.
+     *
+     *  Expressions hold references to the polynomials they use, so they
+     *  must be consumed within the statement that creates them.
+     */
+    template<typename GF, typename E>
+    class GFPolyExpr
+    {
+    public:
+        const E& self() const
+        {
+            return static_cast<const E&>(*this);
+        }
+    };
+
+    template<typename GF, typename Alloc> class GFPoly;
+
+    /*
+     *  Whether the memory [pBegin, pEnd) overlaps [pOtherBegin, pOtherEnd).
+     */
+    inline bool gfRangesOverlap(const void *pBegin, const void *pEnd, const void *pOtherBegin, const void *pOtherEnd)
+    {
+        uintptr_t begin = reinterpret_cast<uintptr_t>(pBegin);
+        uintptr_t end = reinterpret_cast<uintptr_t>(pEnd);
+        uintptr_t otherBegin = reinterpret_cast<uintptr_t>(pOtherBegin);
+        uintptr_t otherEnd = reinterpret_cast<uintptr_t>(pOtherEnd);
+
+        return begin < otherEnd && otherBegin < end;
+    }
+
+    /*
+     *  How an expression stores its operands.  Polynomials are referenced;
+     *  other expressions are small and are copied.
+     */
+    template<typename E>
+    struct GFPolyExprOperand
+    {
+        typedef const E type;
+    };
+
+    template<typename GF, typename Alloc>
+    struct GFPolyExprOperand<GFPoly<GF, Alloc> >
+    {
+        typedef const GFPoly<GF, Alloc>& type;
+    };
+
+    /*
+     *  Sum or difference of two expressions.
+     */
+    template<typename GF, typename L, typename R, bool SUBTRACT>
+    class GFPolySumExpr : public GFPolyExpr<GF, GFPolySumExpr<GF, L, R, SUBTRACT> >
+    {
+    public:
+        GFPolySumExpr(const L& left, const R& right)
+            :   _left(left),
+                _right(right)
+        {
+        }
+
+        size_t getNumCoef() const
+        {
+            size_t leftCount = _left.getNumCoef();
+            size_t rightCount = _right.getNumCoef();
+            return leftCount > rightCount ? leftCount : rightCount;
+        }
+
+        GF coef(size_t n) const
+        {
+            GF leftCoef;
+            if (n < _left.getNumCoef())
+            {
+                leftCoef = _left.coef(n);
+            }
+
+            GF rightCoef;
+            if (n < _right.getNumCoef())
+            {
+                rightCoef = _right.coef(n);
+            }
+
+            return SUBTRACT ? leftCoef - rightCoef : leftCoef + rightCoef;
+        }
+
+        bool refersTo(const void *pBegin, const void *pEnd) const
+        {
+            return _left.refersTo(pBegin, pEnd) || _right.refersTo(pBegin, pEnd);
+        }
+
+        bool refersToShifted(const void *pBegin, const void *pEnd) const
+        {
+            return _left.refersToShifted(pBegin, pEnd) || _right.refersToShifted(pBegin, pEnd);
+        }
+
+    private:
+        typename GFPolyExprOperand<L>::type _left;
+        typename GFPolyExprOperand<R>::type _right;
+    };
+
+    /*
+     *  An expression multiplied by a constant.
+     */
+    template<typename GF, typename E>
+    class GFPolyScaleExpr : public GFPolyExpr<GF, GFPolyScaleExpr<GF, E> >
+    {
+    public:
+        GFPolyScaleExpr(const E& operand, const GF& value)
+            :   _operand(operand),
+                _value(value)
+        {
+        }
+
+        size_t getNumCoef() const
+        {
+            return _operand.getNumCoef();
+        }
+
+        GF coef(size_t n) const
+        {
+            return _operand.coef(n) * _value;
+        }
+
+        bool refersTo(const void *pBegin, const void *pEnd) const
+        {
+            return _operand.refersTo(pBegin, pEnd);
+        }
+
+        bool refersToShifted(const void *pBegin, const void *pEnd) const
+        {
+            return _operand.refersToShifted(pBegin, pEnd);
+        }
+
+    private:
+        typename GFPolyExprOperand<E>::type _operand;
+        GF  _value;
+    };
+
+    /*
+     *  An expression shifted left (multiplied by x^n.)
+     */
+    template<typename GF, typename E>
+    class GFPolyShiftExpr : public GFPolyExpr<GF, GFPolyShiftExpr<GF, E> >
+    {
+    public:
+        GFPolyShiftExpr(const E& operand, size_t shift)
+            :   _operand(operand),
+                _shift(shift)
+        {
+        }
+
+        size_t getNumCoef() const
+        {
+            return _operand.getNumCoef() + _shift;
+        }
+
+        GF coef(size_t n) const
+        {
+            if (n < _shift)
+            {
+                return GF(0);
+            }
+
+            return _operand.coef(n - _shift);
+        }
+
+        bool refersTo(const void *pBegin, const void *pEnd) const
+        {
+            return _operand.refersTo(pBegin, pEnd);
+        }
+
+        bool refersToShifted(const void *pBegin, const void *pEnd) const
+        {
+            if (_shift != 0)
+            {
+                return _operand.refersTo(pBegin, pEnd);
+            }
+
+            return _operand.refersToShifted(pBegin, pEnd);
+        }
+
+    private:
+        typename GFPolyExprOperand<E>::type _operand;
+        size_t  _shift;
+    };
+
+    /*
+     *  Add two polynomials.
+     */
+    template<typename GF, typename L, typename R>
+    GFPolySumExpr<GF, L, R, false> operator+(const GFPolyExpr<GF, L>& left, const GFPolyExpr<GF, R>& right)
+    {
+        return GFPolySumExpr<GF, L, R, false>(left.self(), right.self());
+    }
+
+    /*
+     *  Subtract one polynomial from another.
+     */
+    template<typename GF, typename L, typename R>
+    GFPolySumExpr<GF, L, R, true> operator-(const GFPolyExpr<GF, L>& left, const GFPolyExpr<GF, R>& right)
+    {
+        return GFPolySumExpr<GF, L, R, true>(left.self(), right.self());
+    }
+
+    /*
+     *  Multiply a polynomial by a constant.
+     */
+    template<typename GF, typename E>
+    GFPolyScaleExpr<GF, E> operator*(const GFPolyExpr<GF, E>& operand, const GF& value)
+    {
+        return GFPolyScaleExpr<GF, E>(operand.self(), value);
+    }
+
+    /*
+     *  Shift a polynomial to the left by the specified amount.
+     *  (i.e. equivalent to multiplying by x^n)
+     */
+    template<typename GF, typename E>
+    GFPolyShiftExpr<GF, E> operator<<(const GFPolyExpr<GF, E>& operand, size_t n)
+    {
+        return GFPolyShiftExpr<GF, E>(operand.self(), n);
+    }
+
+    /*
+     *  Equality operations.  Two polynomials are equal if all coefficients
+     *  are equal, or if all coefficients of the shorter match the longer and
+     *  all "extra" coefficients of the longer are zero.  (In other words,
+     *  leading zeros do not cause a polynomial to be "different."
+     */
+    template<typename GF, typename L, typename R>
+    bool operator==(const GFPolyExpr<GF, L>& leftExpr, const GFPolyExpr<GF, R>& rightExpr)
+    {
+        const L& left = leftExpr.self();
+        const R& right = rightExpr.self();
+
+        if (static_cast<const void *>(&left) == static_cast<const void *>(&right))
+        {
+            return true;
+        }
+
+        size_t leftCount = left.getNumCoef();
+        size_t rightCount = right.getNumCoef();
+        size_t longerCount = leftCount > rightCount ? leftCount : rightCount;
+
+        for (size_t i = 0; i < longerCount; i++)
+        {
+            GF leftCoef;
+            if (i < leftCount)
+            {
+                leftCoef = left.coef(i);
+            }
+
+            GF rightCoef;
+            if (i < rightCount)
+            {
+                rightCoef = right.coef(i);
+            }
+
+            if (leftCoef != rightCoef)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename GF, typename L, typename R>
+    bool operator!=(const GFPolyExpr<GF, L>& left, const GFPolyExpr<GF, R>& right)
+    {
+        return !(left == right);
+    }
+
+    template<typename GF, typename E>
+    std::ostream& operator<< (std::ostream& stream, const GFPolyExpr<GF, E>& polyExpr)
+    {
+        const E& poly = polyExpr.self();
+
+        size_t size = poly.getNumCoef();
+        for (size_t i = 0; i < size; i++)
+        {
+            size_t exponent = size - i - 1;
+
+            if (i > 0)
+            {
+                stream << '+';
+            }
+            stream << poly.coef(exponent);
+            if (exponent >= 1)
+            {
+                stream << 'x';
+                if (exponent >= 2)
+                {
+                    stream << '^' << exponent;
+                }
+            }
+        }
+        return stream;
+    }
+}
+
+#endif  // GFPOLYEXPR_DOT_H
@@ -0,0 +1,319 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFPOLYGCD_DOT_H
+#define GFPOLYGCD_DOT_H
+
+#include <stddef.h>
+#include "gfpoly.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  Tuning parameter for the extended GCD.  Once the remainders have
+     *  fewer than HALF_GCD_THRESHOLD coefficients, the remaining steps
+     *  are done by classic Euclid, which is faster for small degrees.
+     *  Timing GF(256) and GF(929) GCDs of 64 to 2048 coefficients put
+     *  the crossover at about 32 for both; half-GCD is roughly three
+     *  times faster at 2048.
+     */
+    template<typename GF>
+    struct GFPolyGcdTraits
+    {
+        static const int HALF_GCD_THRESHOLD = 32;
+    };
+
+    /*
+     *  Extended Euclidean algorithm for polynomials.
+     *
+     *  Classic Euclid performs one division per step, which is O(n^2)
+     *  overall.  For large degrees this uses the half-GCD algorithm
+     *  instead (see Yap, "Fundamental Problems of Algorithmic Algebra",
+     *  lecture II.)  It relies on the fact that the first half of the
+     *  quotient sequence of A and B depends only on the top half of
+     *  their coefficients, so it can be computed recursively on
+     *  polynomials of half the size.  The quotients are accumulated in
+     *  a 2x2 matrix of polynomials, and the multiplications and
+     *  divisions underneath use GFPoly's fast algorithms, for a total
+     *  of O(M(n) log n).
+     *
+     *  Degrees are ints, with the zero polynomial having degree -1.
+     */
+    template<typename GF>
+    class GFPolyGcd
+    {
+    public:
+        typedef GFPoly<GF> Poly;
+
+        /*
+         *  Computes gcd = s * a + t * b, with the gcd made monic.  If
+         *  both a and b are zero, all three outputs are zero.
+         */
+        static void extendedGcd(const Poly& a, const Poly& b, Poly& gcd, Poly& s, Poly& t)
+        {
+            Matrix matrix;
+            Poly r0(a);
+            Poly r1(b);
+            r0.trimLeadingZeros();
+            r1.trimLeadingZeros();
+
+            reduce(r0, r1, 0, matrix);
+
+            int gcdDegree = degree(r0);
+            if (gcdDegree >= 0)
+            {
+                GF scale = GF(1) / r0[gcdDegree];
+                r0 = r0 * scale;
+                matrix.m[0][0] = matrix.m[0][0] * scale;
+                matrix.m[0][1] = matrix.m[0][1] * scale;
+            }
+
+            gcd.swap(r0);
+            s.swap(matrix.m[0][0]);
+            t.swap(matrix.m[0][1]);
+        }
+
+        /*
+         *  Runs the remainder sequence of a and b only until the first
+         *  remainder with degree less than stopDegree, returning that
+         *  remainder as r = s * a + t * b.  This is the form needed for
+         *  solving key equations (Sugiyama's algorithm) and for rational
+         *  reconstruction.  The outputs are not normalized.  If b already
+         *  has degree less than stopDegree, r = b.
+         */
+        static void partialGcd(const Poly& a, const Poly& b, int stopDegree, Poly& r, Poly& s, Poly& t)
+        {
+            Matrix matrix;
+            Poly r0(a);
+            Poly r1(b);
+            r0.trimLeadingZeros();
+            r1.trimLeadingZeros();
+
+            reduce(r0, r1, stopDegree, matrix);
+
+            r.swap(r1);
+            s.swap(matrix.m[1][0]);
+            t.swap(matrix.m[1][1]);
+        }
+
+        /*
+         *  Degree of a polynomial, ignoring leading zeros.
+         */
+        static int degree(const Poly& poly)
+        {
+            for (size_t i = poly.getNumCoef(); i > 0; i--)
+            {
+                if (poly[i - 1].toInt() != 0)
+                {
+                    return static_cast<int>(i - 1);
+                }
+            }
+
+            return -1;
+        }
+
+    private:
+        /*
+         *  A 2x2 matrix of polynomials.  Applied to the pair (r0, r1) it
+         *  produces a later pair in the remainder sequence.
+         */
+        struct Matrix
+        {
+            Matrix()
+            {
+                m[0][0][0] = GF(1);
+                m[1][1][0] = GF(1);
+            }
+
+            Poly m[2][2];
+        };
+
+        /*
+         *  Advances (r0, r1) along the remainder sequence until r1 has
+         *  degree less than stopDegree (or is zero), accumulating the
+         *  quotients in matrix.
+         */
+        static void reduce(Poly& r0, Poly& r1, int stopDegree, Matrix& matrix)
+        {
+            while (degree(r1) >= stopDegree && degree(r1) >= 0)
+            {
+                int n = degree(r0);
+                int m = degree(r1);
+
+                if (n > m && m >= GFPolyGcdTraits<GF>::HALF_GCD_THRESHOLD)
+                {
+                    /*
+                     *  Half-GCD on the top coefficients.  Shifting both
+                     *  by k = 2 * stopDegree - n makes the half-GCD stop
+                     *  exactly at stopDegree, when that is within reach.
+                     */
+                    int k = 2 * stopDegree - n;
+                    if (k < 0)
+                    {
+                        k = 0;
+                    }
+
+                    Matrix step;
+                    halfGcd(shiftDown(r0, k), shiftDown(r1, k), step);
+                    apply(step, r0, r1);
+                    multiply(step, matrix);
+
+                    if (degree(r1) < stopDegree || degree(r1) < 0)
+                    {
+                        break;
+                    }
+                }
+
+                euclidStep(r0, r1, matrix);
+            }
+        }
+
+        /*
+         *  Computes the matrix that reduces (a, b), with deg a = n > deg b,
+         *  to the consecutive remainders (a', b') with
+         *  deg a' >= ceil(n / 2) > deg b'.
+         */
+        static void halfGcd(const Poly& a, const Poly& b, Matrix& output)
+        {
+            int n = degree(a);
+            int half = (n + 1) / 2;
+
+            output = Matrix();
+            if (degree(b) < half)
+            {
+                return;
+            }
+
+            if (n < GFPolyGcdTraits<GF>::HALF_GCD_THRESHOLD)
+            {
+                Poly c(a);
+                Poly d(b);
+                while (degree(d) >= half)
+                {
+                    euclidStep(c, d, output);
+                }
+                return;
+            }
+
+            halfGcd(shiftDown(a, half), shiftDown(b, half), output);
+
+            Poly c(a);
+            Poly d(b);
+            apply(output, c, d);
+            if (degree(d) < half)
+            {
+                return;
+            }
+
+            euclidStep(c, d, output);
+            if (degree(d) < 0)
+            {
+                return;
+            }
+
+            int k = 2 * half - degree(c);
+            Matrix second;
+            halfGcd(shiftDown(c, k), shiftDown(d, k), second);
+            multiply(second, output);
+        }
+
+        /*
+         *  One step of classic Euclid:  (r0, r1) = (r1, r0 mod r1), with
+         *  the quotient folded into the matrix.
+         */
+        static void euclidStep(Poly& r0, Poly& r1, Matrix& matrix)
+        {
+            Poly quotient;
+            Poly remainder;
+            r0.divmod(r1, quotient, remainder);
+            quotient.trimLeadingZeros();
+            remainder.trimLeadingZeros();
+
+            r0.swap(r1);
+            r1.swap(remainder);
+
+            Poly next = matrix.m[0][0] - quotient * matrix.m[1][0];
+            next.trimLeadingZeros();
+            matrix.m[0][0].swap(matrix.m[1][0]);
+            matrix.m[1][0].swap(next);
+
+            next = matrix.m[0][1] - quotient * matrix.m[1][1];
+            next.trimLeadingZeros();
+            matrix.m[0][1].swap(matrix.m[1][1]);
+            matrix.m[1][1].swap(next);
+        }
+
+        /*
+         *  (r0, r1) = matrix * (r0, r1)
+         */
+        static void apply(const Matrix& matrix, Poly& r0, Poly& r1)
+        {
+            Poly next0 = matrix.m[0][0] * r0 + matrix.m[0][1] * r1;
+            Poly next1 = matrix.m[1][0] * r0 + matrix.m[1][1] * r1;
+            next0.trimLeadingZeros();
+            next1.trimLeadingZeros();
+
+            r0.swap(next0);
+            r1.swap(next1);
+        }
+
+        /*
+         *  right = left * right
+         */
+        static void multiply(const Matrix& left, Matrix& right)
+        {
+            Matrix product;
+            for (int row = 0; row < 2; row++)
+            {
+                for (int col = 0; col < 2; col++)
+                {
+                    product.m[row][col] = left.m[row][0] * right.m[0][col] + left.m[row][1] * right.m[1][col];
+                    product.m[row][col].trimLeadingZeros();
+                }
+            }
+
+            for (int row = 0; row < 2; row++)
+            {
+                for (int col = 0; col < 2; col++)
+                {
+                    right.m[row][col].swap(product.m[row][col]);
+                }
+            }
+        }
+
+        /*
+         *  poly div x^k
+         */
+        static Poly shiftDown(const Poly& poly, int k)
+        {
+            size_t count = poly.getNumCoef();
+            if (static_cast<size_t>(k) >= count)
+            {
+                return Poly();
+            }
+
+            Poly output(count - k);
+            for (size_t i = k; i < count; i++)
+            {
+                output[i - k] = poly[i];
+            }
+
+            return output;
+        }
+    };
+}
+
+#endif  // GFPOLYGCD_DOT_H
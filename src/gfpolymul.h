@@ -0,0 +1,522 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFPOLYMUL_DOT_H
+#define GFPOLYMUL_DOT_H
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <stddef.h>
+#include "eccThreadPool.h"
+
+namespace SilverBayTech
+{
+    template<unsigned int SIZE, unsigned int POLYNOMIAL> class GFBinary;
+    template<unsigned int SIZE> class GFPrime;
+
+    /*
+     *  Tuning parameters for polynomial multiplication over a particular
+     *  field.  Products where the shorter operand has fewer than
+     *  KARATSUBA_THRESHOLD coefficients are done using the schoolbook
+     *  method - below that point the extra additions Karatsuba needs
+     *  cost more than the multiplications it saves.
+     *
+     *  The values below were measured on x86-64 by timing balanced
+     *  products of 40 to 1000 coefficients.  Because each element
+     *  multiplication goes through the log/exp tables, schoolbook loses
+     *  early.  Fields without a specialization use the generic values.
+     *
+     *  Products never use the additive FFT of gfbinaryfft.h.  Of the
+     *  products that fit one transform, none was faster by FFT in GF(256),
+     *  GF(1024) or GF(4096) - 1024 by 1024 coefficients over GF(4096)
+     *  take 590 us against 355 us by Karatsuba.
+     */
+    template<typename GF>
+    struct GFPolyMultiplyTraits
+    {
+        static const size_t KARATSUBA_THRESHOLD = 16;
+    };
+
+    template<unsigned int POLYNOMIAL>
+    struct GFPolyMultiplyTraits<GFBinary<256, POLYNOMIAL> >
+    {
+        static const size_t KARATSUBA_THRESHOLD = 12;
+    };
+
+    template<>
+    struct GFPolyMultiplyTraits<GFPrime<929> >
+    {
+        static const size_t KARATSUBA_THRESHOLD = 16;
+    };
+
+    /*
+     *  Storage for GFPolyParallel.  It is a template only so that its
+     *  static members can be defined in this header.
+     */
+    template<typename Unused>
+    struct GFPolyParallelSettings
+    {
+        static std::atomic<EccThreadPool *>     s_pPool;
+        static std::atomic<size_t>              s_threshold;
+    };
+
+    /*
+     *  Process-wide settings for multithreaded multiplication.  Once a
+     *  pool is enabled, Karatsuba products whose operands have at least
+     *  getThreshold() coefficients run their three half-size subproducts
+     *  as parallel tasks (recursively, down to the threshold.)  Field
+     *  arithmetic is exact, so the results are identical whatever the
+     *  number of threads.
+     *
+     *  The settings are atomic, so they may be changed while other
+     *  threads multiply, but a multiplier reads them once, when it is
+     *  built:  a product already under way keeps the pool it started
+     *  with.  After disable(), let those products finish before
+     *  destroying the pool.
+     *
+     *  A 1024-coefficient GF(256) product takes about 0.5 ms on one
+     *  core, so at the default threshold each task is a few hundred
+     *  times the cost of scheduling it.
+     */
+    class GFPolyParallel
+    {
+    public:
+        static const size_t DEFAULT_THRESHOLD = 1024;
+
+        static void enable(EccThreadPool *pPool, size_t threshold = DEFAULT_THRESHOLD)
+        {
+            GFPolyParallelSettings<void>::s_threshold.store(threshold);
+            GFPolyParallelSettings<void>::s_pPool.store(pPool);
+        }
+
+        static void disable()
+        {
+            GFPolyParallelSettings<void>::s_pPool.store(0);
+        }
+
+        static EccThreadPool *getPool()
+        {
+            return GFPolyParallelSettings<void>::s_pPool.load();
+        }
+
+        static size_t getThreshold()
+        {
+            return GFPolyParallelSettings<void>::s_threshold.load();
+        }
+    };
+
+    template<typename Unused>
+    std::atomic<EccThreadPool *> GFPolyParallelSettings<Unused>::s_pPool(0);
+
+    template<typename Unused>
+    std::atomic<size_t> GFPolyParallelSettings<Unused>::s_threshold(GFPolyParallel::DEFAULT_THRESHOLD);
+
+    /*
+     *  Multiplies polynomials stored as arrays of coefficients (lowest
+     *  exponent first, the same order GFPoly uses internally.)  Large
+     *  products use recursive Karatsuba multiplication, which is
+     *  O(n^1.58) rather than O(n^2).
+     *
+     *  The scratch space Karatsuba needs is kept inside the object, so
+     *  a multiplier that is reused for products of similar size does
+     *  not allocate after the first call.  The scratch comes from Alloc,
+     *  so with a GFArenaAllocator the multiplier draws on an arena like
+     *  the polynomials it works for.  A multiplier is not thread-safe -
+     *  use one per thread.  (When it runs parallel subproducts itself,
+     *  the tasks get scratch of their own from the heap rather than from
+     *  Alloc, since the subproducts nest on the pool's threads and an
+     *  arena is not thread-safe.)
+     */
+    template<typename GF, typename Alloc = std::allocator<GF> >
+    class GFPolyMultiplier
+    {
+    public:
+        /*
+         *  Constructs a multiplier, optionally preallocating enough
+         *  scratch space for products whose operands have up to
+         *  maxCoef coefficients.
+         */
+        GFPolyMultiplier(size_t maxCoef = 0, const Alloc& alloc = Alloc())
+            :   _scratch(alloc),
+                _pPool(GFPolyParallel::getPool()),
+                _parallelThreshold(GFPolyParallel::getThreshold())
+        {
+            reserve(maxCoef);
+        }
+
+        /*
+         *  Overrides the process-wide GFPolyParallel settings for this
+         *  multiplier.  A null pool makes it single-threaded.
+         */
+        void setThreadPool(EccThreadPool *pPool, size_t threshold = GFPolyParallel::DEFAULT_THRESHOLD)
+        {
+            _pPool = pPool;
+            _parallelThreshold = threshold;
+        }
+
+        /*
+         *  Preallocates scratch for operands of up to maxCoef coefficients.
+         */
+        void reserve(size_t maxCoef)
+        {
+            size_t needed = 2 * maxCoef + scratchSize(maxCoef);
+            if (_scratch.size() < needed)
+            {
+                _scratch.resize(needed);
+            }
+        }
+
+        /*
+         *  Computes pOutput = A * B.  pOutput must have room for
+         *  numA + numB - 1 coefficients, and must not overlap either input.
+         */
+        void multiply(const GF *pA, size_t numA, const GF *pB, size_t numB, GF *pOutput)
+        {
+            size_t outputCount = numA + numB - 1;
+            for (size_t i = 0; i < outputCount; i++)
+            {
+                pOutput[i] = GF(0);
+            }
+
+            multiplyAdd(pA, numA, pB, numB, pOutput);
+        }
+
+        /*
+         *  Computes pOutput += A * B.
+         */
+        void multiplyAdd(const GF *pA, size_t numA, const GF *pB, size_t numB, GF *pOutput)
+        {
+            if (numA < numB)
+            {
+                const GF *pTemp = pA;
+                pA = pB;
+                pB = pTemp;
+
+                size_t countTemp = numA;
+                numA = numB;
+                numB = countTemp;
+            }
+
+            if (numB < GFPolyMultiplyTraits<GF>::KARATSUBA_THRESHOLD)
+            {
+                schoolbookAdd(pA, numA, pB, numB, pOutput);
+                return;
+            }
+
+            /*
+             *  Karatsuba works on equal-length operands, so the longer
+             *  operand is processed in chunks the length of the shorter one.
+             *  The first 2 * numB - 1 elements of the scratch hold each
+             *  partial product.
+             */
+            reserve(numB);
+
+            size_t productCount = 2 * numB - 1;
+            size_t offset = 0;
+            for (; offset + numB <= numA; offset += numB)
+            {
+                GF *pProduct = &_scratch[0];
+                karatsuba(pA + offset, pB, numB, pProduct, pProduct + productCount);
+
+                for (size_t i = 0; i < productCount; i++)
+                {
+                    pOutput[offset + i] += pProduct[i];
+                }
+            }
+
+            if (offset < numA)
+            {
+                multiplyAdd(pA + offset, numA - offset, pB, numB, pOutput + offset);
+            }
+        }
+
+        /*
+         *  Schoolbook multiplication: pOutput += A * B.
+         */
+        static void schoolbookAdd(const GF *pA, size_t numA, const GF *pB, size_t numB, GF *pOutput)
+        {
+            for (size_t i = 0; i < numA; i++)
+            {
+                GF aCoef = pA[i];
+                if (aCoef.toInt() == 0)
+                {
+                    continue;
+                }
+
+                GF *pOut = pOutput + i;
+                for (size_t j = 0; j < numB; j++)
+                {
+                    pOut[j] += aCoef * pB[j];
+                }
+            }
+        }
+
+        /*
+         *  Amount of scratch (in elements) that karatsuba() needs
+         *  for operands with n coefficients.
+         */
+        static size_t scratchSize(size_t n)
+        {
+            size_t total = 0;
+            while (n >= GFPolyMultiplyTraits<GF>::KARATSUBA_THRESHOLD)
+            {
+                size_t high = n - n / 2;
+                total += 4 * high - 1;
+                n = high;
+            }
+
+            return total;
+        }
+
+    private:
+        /*
+         *  Karatsuba multiplication of two n-coefficient operands into
+         *  the 2n-1 coefficients at pOutput.  With A = A0 + x^m A1 and
+         *  B = B0 + x^m B1:
+         *
+         *      A*B = A0B0 + x^m ((A0+A1)(B0+B1) - A0B0 - A1B1) + x^2m A1B1
+         *
+         *  A0B0 and A1B1 are built in place in the output, while the
+         *  middle product uses pScratch, which must have scratchSize(n)
+         *  elements.
+         */
+        void karatsuba(const GF *pA, const GF *pB, size_t n, GF *pOutput, GF *pScratch) const
+        {
+            if (n < GFPolyMultiplyTraits<GF>::KARATSUBA_THRESHOLD)
+            {
+                size_t outputCount = 2 * n - 1;
+                for (size_t i = 0; i < outputCount; i++)
+                {
+                    pOutput[i] = GF(0);
+                }
+                schoolbookAdd(pA, n, pB, n, pOutput);
+                return;
+            }
+
+            if (_pPool != 0 && n >= _parallelThreshold)
+            {
+                parallelKaratsuba(pA, pB, n, pOutput);
+                return;
+            }
+
+            size_t low = n / 2;
+            size_t high = n - low;
+
+            karatsuba(pA, pB, low, pOutput, pScratch);
+            pOutput[2 * low - 1] = GF(0);
+            karatsuba(pA + low, pB + low, high, pOutput + 2 * low, pScratch);
+
+            GF *pSumA = pScratch;
+            GF *pSumB = pSumA + high;
+            GF *pMiddle = pSumB + high;
+            GF *pNext = pMiddle + 2 * high - 1;
+
+            addHalves(pA, pB, low, high, pSumA, pSumB);
+            karatsuba(pSumA, pSumB, high, pMiddle, pNext);
+            addMiddle(pOutput, pMiddle, low, high);
+        }
+
+        /*
+         *  The same as karatsuba(), but with the low and high products
+         *  running as tasks on the pool while this thread does the middle
+         *  one.  Each gets its own scratch, from the heap - this may be
+         *  running on a pool thread, where the multiplier's allocator
+         *  (an arena, say) must not be used.
+         */
+        void parallelKaratsuba(const GF *pA, const GF *pB, size_t n, GF *pOutput) const
+        {
+            size_t low = n / 2;
+            size_t high = n - low;
+
+            std::vector<GF> sums(2 * high);
+            std::vector<GF> middle(2 * high - 1);
+            std::vector<GF> lowScratch(scratchSize(low) + 1);
+            std::vector<GF> highScratch(scratchSize(high) + 1);
+            std::vector<GF> middleScratch(scratchSize(high) + 1);
+
+            GF *pSumA = &sums[0];
+            GF *pSumB = pSumA + high;
+            GF *pLowScratch = &lowScratch[0];
+            GF *pHighScratch = &highScratch[0];
+            addHalves(pA, pB, low, high, pSumA, pSumB);
+
+            pOutput[2 * low - 1] = GF(0);
+            {
+                EccTaskGroup group(*_pPool);
+                group.run([=]() { karatsuba(pA, pB, low, pOutput, pLowScratch); });
+                group.run([=]() { karatsuba(pA + low, pB + low, high, pOutput + 2 * low, pHighScratch); });
+
+                karatsuba(pSumA, pSumB, high, &middle[0], &middleScratch[0]);
+                group.wait();
+            }
+
+            addMiddle(pOutput, &middle[0], low, high);
+        }
+
+        /*
+         *  (A0 + A1) and (B0 + B1), where the high halves may be one longer.
+         */
+        static void addHalves(const GF *pA, const GF *pB, size_t low, size_t high, GF *pSumA, GF *pSumB)
+        {
+            for (size_t i = 0; i < low; i++)
+            {
+                pSumA[i] = pA[i] + pA[low + i];
+                pSumB[i] = pB[i] + pB[low + i];
+            }
+            if (high > low)
+            {
+                pSumA[low] = pA[2 * low];
+                pSumB[low] = pB[2 * low];
+            }
+        }
+
+        /*
+         *  Given A0B0 and A1B1 in the output and (A0+A1)(B0+B1) in pMiddle,
+         *  adds the middle term into the output.
+         */
+        static void addMiddle(GF *pOutput, GF *pMiddle, size_t low, size_t high)
+        {
+            const GF *pLowProduct = pOutput;
+            const GF *pHighProduct = pOutput + 2 * low;
+            for (size_t i = 0; i < 2 * low - 1; i++)
+            {
+                pMiddle[i] -= pLowProduct[i];
+            }
+            for (size_t i = 0; i < 2 * high - 1; i++)
+            {
+                pMiddle[i] -= pHighProduct[i];
+            }
+
+            GF *pOut = pOutput + low;
+            for (size_t i = 0; i < 2 * high - 1; i++)
+            {
+                pOut[i] += pMiddle[i];
+            }
+        }
+
+        std::vector<GF, Alloc>  _scratch;
+        EccThreadPool           *_pPool;
+        size_t                  _parallelThreshold;
+    };
+
+    /*
+     *  Multipliers kept between GFPoly products, so that their scratch is
+     *  allocated once rather than on every product.  A multiplier is taken
+     *  out of the cache for the length of a product, so products that
+     *  overlap (on several threads, or a pool task run while its caller
+     *  waits) each get one of their own.
+     */
+    template<typename GF, typename Alloc>
+    struct GFPolyMultiplierCacheStorage
+    {
+        enum { MAX_CACHED = 8 };
+
+        ~GFPolyMultiplierCacheStorage()
+        {
+            for (size_t i = 0; i < numCached; i++)
+            {
+                delete pCached[i];
+            }
+        }
+
+        std::mutex                      lock;
+        GFPolyMultiplier<GF, Alloc>     *pCached[MAX_CACHED];
+        size_t                          numCached;
+    };
+
+    /*
+     *  Computes GFPoly products.  Only allocators without state use the
+     *  cache, since any instance of one can free what another allocated.
+     *  A stateful allocator such as GFArenaAllocator gets a multiplier of
+     *  its own for each product, whose scratch must not outlive the
+     *  allocator's arena.
+     */
+    template<typename GF, typename Alloc, bool CACHED = std::is_empty<Alloc>::value>
+    struct GFPolyMultiplierCache
+    {
+        static void multiply(const Alloc& alloc, const GF *pA, size_t numA, const GF *pB, size_t numB, GF *pOutput)
+        {
+            GFPolyMultiplier<GF, Alloc> multiplier(0, alloc);
+            multiplier.multiply(pA, numA, pB, numB, pOutput);
+        }
+    };
+
+    template<typename GF, typename Alloc>
+    struct GFPolyMultiplierCache<GF, Alloc, true>
+    {
+        static void multiply(const Alloc& alloc, const GF *pA, size_t numA, const GF *pB, size_t numB, GF *pOutput)
+        {
+            /*
+             *  Schoolbook products need no scratch.
+             */
+            size_t threshold = GFPolyMultiplyTraits<GF>::KARATSUBA_THRESHOLD;
+            if (numA < threshold || numB < threshold)
+            {
+                size_t outputCount = numA + numB - 1;
+                for (size_t i = 0; i < outputCount; i++)
+                {
+                    pOutput[i] = GF(0);
+                }
+
+                GFPolyMultiplier<GF, Alloc>::schoolbookAdd(pA, numA, pB, numB, pOutput);
+                return;
+            }
+
+            GFPolyMultiplier<GF, Alloc> *pMultiplier = take(alloc);
+            pMultiplier->setThreadPool(GFPolyParallel::getPool(), GFPolyParallel::getThreshold());
+            pMultiplier->multiply(pA, numA, pB, numB, pOutput);
+            give(pMultiplier);
+        }
+
+    private:
+        static GFPolyMultiplier<GF, Alloc> *take(const Alloc& alloc)
+        {
+            {
+                std::lock_guard<std::mutex> lock(s_storage.lock);
+                if (s_storage.numCached != 0)
+                {
+                    return s_storage.pCached[--s_storage.numCached];
+                }
+            }
+
+            return new GFPolyMultiplier<GF, Alloc>(0, alloc);
+        }
+
+        static void give(GFPolyMultiplier<GF, Alloc> *pMultiplier)
+        {
+            {
+                std::lock_guard<std::mutex> lock(s_storage.lock);
+                if (s_storage.numCached < GFPolyMultiplierCacheStorage<GF, Alloc>::MAX_CACHED)
+                {
+                    s_storage.pCached[s_storage.numCached++] = pMultiplier;
+                    return;
+                }
+            }
+
+            delete pMultiplier;
+        }
+
+        static GFPolyMultiplierCacheStorage<GF, Alloc>  s_storage;
+    };
+
+    template<typename GF, typename Alloc>
+    GFPolyMultiplierCacheStorage<GF, Alloc> GFPolyMultiplierCache<GF, Alloc, true>::s_storage;
+}
+
+#endif  // GFPOLYMUL_DOT_H
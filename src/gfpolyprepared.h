@@ -0,0 +1,242 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFPOLYPREPARED_DOT_H
+#define GFPOLYPREPARED_DOT_H
+
+#include <vector>
+#include <stdint.h>
+#include "gfpoly.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  A divisor that has been prepared for taking the remainder of many
+     *  dividends, such as a Reed-Solomon generator polynomial.
+     *
+     *  The remainder of division by g is the same as the remainder of
+     *  division by g scaled to be monic, so the divisor is stored in
+     *  monic form and as the logs of its coefficients.  Each step of the
+     *  division then needs one log lookup for the feedback term, plus an
+     *  exp lookup per divisor coefficient.  No division and no copying of
+     *  the divisor takes place per call, and the remainder is built
+     *  directly in the caller's storage.
+     *
+     *  A prepared divisor is immutable once built, so it may be shared
+     *  between threads.
+     */
+    template<typename GF>
+    class PreparedDivisor
+    {
+    public:
+        /*
+         *  Prepares the specified divisor.  Leading zero coefficients are
+         *  ignored.  The divisor must not be zero.
+         */
+        template<typename Alloc>
+        PreparedDivisor(const GFPoly<GF, Alloc>& divisor)
+        {
+            prepare(&divisor[0], divisor.getNumCoef());
+        }
+
+        /*
+         *  Prepares a divisor given as an array of coefficients, lowest
+         *  exponent first.
+         */
+        PreparedDivisor(const GF *pDivisor, size_t numCoef)
+        {
+            prepare(pDivisor, numCoef);
+        }
+
+        /*
+         *  Degree of the divisor.  This is the number of coefficients in
+         *  the remainder (although a remainder always has at least one.)
+         */
+        size_t getDegree() const
+        {
+            return _degree;
+        }
+
+        size_t getRemainderCoef() const
+        {
+            return _degree > 0 ? _degree : 1;
+        }
+
+        /*
+         *  The monic form of the divisor.
+         */
+        const GFPoly<GF>& getMonic() const
+        {
+            return _monic;
+        }
+
+        /*
+         *  Computes the remainder of the dividend (an array of coefficients,
+         *  lowest exponent first) into pRemainder, which must have room for
+         *  getRemainderCoef() coefficients and must not overlap the dividend.
+         */
+        void remainder(const GF *pDividend, size_t numDividend, GF *pRemainder) const
+        {
+            size_t remainderCoefs = getRemainderCoef();
+            for (size_t i = 0; i < remainderCoefs; i++)
+            {
+                pRemainder[i] = GF(0);
+            }
+
+            for (size_t j = numDividend; j > 0; j--)
+            {
+                shiftIn(pRemainder, pDividend[j - 1]);
+            }
+        }
+
+        /*
+         *  Computes the remainder of the dividend into an existing
+         *  polynomial.  The output is only reallocated if it is too small.
+         */
+        template<typename Alloc>
+        void remainder(const GFPoly<GF, Alloc>& dividend, GFPoly<GF, Alloc>& output) const
+        {
+            output.resize(getRemainderCoef());
+            remainder(&dividend[0], dividend.getNumCoef(), &output[0]);
+        }
+
+        /*
+         *  Computes the remainder of a polynomial expression, such as a
+         *  shifted GFPolyView over a message buffer, into pRemainder.  The
+         *  dividend's coefficients are read one at a time, highest first,
+         *  so nothing is materialized.
+         */
+        template<typename E>
+        void remainder(const GFPolyExpr<GF, E>& dividend, GF *pRemainder) const
+        {
+            const E& source = dividend.self();
+
+            size_t remainderCoefs = getRemainderCoef();
+            for (size_t i = 0; i < remainderCoefs; i++)
+            {
+                pRemainder[i] = GF(0);
+            }
+
+            for (size_t j = source.getNumCoef(); j > 0; j--)
+            {
+                shiftIn(pRemainder, source.coef(j - 1));
+            }
+        }
+
+        /*
+         *  Advances a partial remainder R by one dividend coefficient:
+         *  R = (R * x + coef) mod divisor.  Since the divisor is monic,
+         *  x^degree = -(the rest of the divisor), so the coefficient
+         *  shifted out the top feeds back into every other position.
+         */
+        void shiftIn(GF *pRemainder, const GF& coef) const
+        {
+            if (_degree == 0)
+            {
+                return;
+            }
+
+            GF feedback = pRemainder[_degree - 1];
+            for (size_t k = _degree - 1; k > 0; k--)
+            {
+                pRemainder[k] = pRemainder[k - 1];
+            }
+            pRemainder[0] = coef;
+
+            if (feedback.toInt() == 0)
+            {
+                return;
+            }
+
+            uint32_t feedbackLog = feedback.log();
+            for (size_t k = 0; k < _degree; k++)
+            {
+                if (_logs[k] != ZERO_LOG)
+                {
+                    pRemainder[k] -= GF::exp(feedbackLog + _logs[k]);
+                }
+            }
+        }
+
+        /*
+         *  The same step in the form a Reed-Solomon encoder's shift
+         *  register takes:  pParity holds -R, highest exponent first, as
+         *  symbols of type T, and the symbol enters at the top, so
+         *  R = (R * x + symbol * x^degree) mod divisor.  Shifting in a
+         *  message from zero leaves -((message << degree) % divisor),
+         *  the message's parity, in pParity.
+         */
+        template<typename T>
+        void shiftInParity(T *pParity, const GF& symbol) const
+        {
+            if (_degree == 0)
+            {
+                return;
+            }
+
+            GF feedback = symbol - GF(pParity[0]);
+            for (size_t j = 0; j + 1 < _degree; j++)
+            {
+                pParity[j] = pParity[j + 1];
+            }
+            pParity[_degree - 1] = static_cast<T>(0);
+
+            if (feedback.toInt() == 0)
+            {
+                return;
+            }
+
+            uint32_t feedbackLog = feedback.log();
+            for (size_t j = 0; j < _degree; j++)
+            {
+                uint32_t coefLog = _logs[_degree - 1 - j];
+                if (coefLog != ZERO_LOG)
+                {
+                    GF sum = GF(pParity[j]) + GF::exp(feedbackLog + coefLog);
+                    pParity[j] = static_cast<T>(sum.toInt());
+                }
+            }
+        }
+
+    private:
+        void prepare(const GF *pDivisor, size_t numCoef)
+        {
+            while (numCoef > 1 && pDivisor[numCoef - 1].toInt() == 0)
+            {
+                numCoef--;
+            }
+
+            _degree = numCoef - 1;
+
+            GF leadingInverse = GF(1) / pDivisor[_degree];
+            _monic = GFPoly<GF>(numCoef);
+            _logs.resize(numCoef);
+            for (size_t k = 0; k < numCoef; k++)
+            {
+                _monic[k] = pDivisor[k] * leadingInverse;
+                _logs[k] = _monic[k].toInt() == 0 ? ZERO_LOG : _monic[k].log();
+            }
+        }
+
+        static const uint32_t ZERO_LOG = 0xFFFFFFFF;
+
+        size_t                  _degree;
+        GFPoly<GF>              _monic;
+        std::vector<uint32_t>   _logs;
+    };
+}
+
+#endif  // GFPOLYPREPARED_DOT_H
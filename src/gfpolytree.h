@@ -0,0 +1,395 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFPOLYTREE_DOT_H
+#define GFPOLYTREE_DOT_H
+
+#include <vector>
+#include <stddef.h>
+#include "gfpoly.h"
+#include "gfpolymul.h"
+#include "gfpolydiv.h"
+#include "gfbinaryfft.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  A subproduct tree over a set of points p(0) ... p(n-1), used to
+     *  evaluate a polynomial at all of the points, or to interpolate
+     *  the polynomial through values at the points, in O(M(n) log n)
+     *  rather than O(n^2).  (See "Modern Computer Algebra", chapter 10.)
+     *
+     *  The leaves of the tree are the linear factors (x - p(i)), and each
+     *  node above is the product of its two children, so node j on level
+     *  k is the product over points j * 2^k up to (j + 1) * 2^k.  A node
+     *  without a sibling is carried up unchanged.
+     *
+     *  In a binary field, evaluating at a quarter or more of the field's
+     *  elements uses the additive FFT instead, which evaluates at every
+     *  element at once in O(q log^2 q) for a field of q elements.  Over
+     *  GF(256) 64 points take 11 us either way, and over GF(4096) 1024
+     *  points take 0.40 ms by FFT against 2.2 ms by the tree, or 2.9 ms
+     *  counting the tree's construction - which evaluateAt then skips.
+     *
+     *  Building the tree is the expensive part, so a tree can be kept
+     *  and reused whenever the same set of points comes up again.  Each
+     *  node is held as a GFPolyDivider, which also caches the Newton
+     *  reciprocal used to divide by the large nodes, and the weights
+     *  needed for interpolation are computed on first use.  A tree is
+     *  not thread-safe - use one per thread.
+     */
+    template<typename GF>
+    class GFPolySubproductTree
+    {
+    public:
+        /*
+         *  Nodes at or below this level cover at most 2^DIRECT_EVAL_LEVEL
+         *  points, so their remainders are short enough to evaluate
+         *  directly at each point rather than divide further.
+         */
+        static const size_t DIRECT_EVAL_LEVEL = 3;
+
+        /*
+         *  Evaluation takes the FFT, where the field has one, for at least
+         *  FIELD_SIZE / FFT_EVAL_FRACTION points.
+         */
+        static const size_t FFT_EVAL_FRACTION = 4;
+
+        /*
+         *  Builds the tree for the specified points.  There must be at
+         *  least one point.
+         */
+        GFPolySubproductTree(const GF *pPoints, size_t numPoints)
+            :   _points(pPoints, pPoints + numPoints)
+        {
+            build();
+        }
+
+        GFPolySubproductTree(const std::vector<GF>& points)
+            :   _points(points)
+        {
+            build();
+        }
+
+        size_t getNumPoints() const
+        {
+            return _points.size();
+        }
+
+        const GF& getPoint(size_t n) const
+        {
+            return _points[n];
+        }
+
+        /*
+         *  The product of (x - p(i)) over all the points.
+         */
+        GFPoly<GF> getProduct() const
+        {
+            const GFPolyDivider<GF>& root = _levels.back()[0];
+            GFPoly<GF> output(root.getNumCoef());
+            for (size_t i = 0; i < root.getNumCoef(); i++)
+            {
+                output[i] = root[i];
+            }
+
+            return output;
+        }
+
+        /*
+         *  Evaluates the polynomial (coefficients lowest exponent first)
+         *  at every point, writing getNumPoints() values to pValues.
+         *  The polynomial is reduced modulo the root, and the remainders
+         *  are then reduced down the tree - at a leaf, the remainder
+         *  modulo (x - p) is the value at p.
+         */
+        void evaluate(const GF *pCoef, size_t numCoef, GF *pValues)
+        {
+            size_t numPoints = _points.size();
+            if (evaluateByFFT(pCoef, numCoef, &_points[0], numPoints, pValues, _fieldValues))
+            {
+                return;
+            }
+
+            size_t top = _levels.size() - 1;
+
+            _current.resize(numPoints);
+            _next.resize(numPoints);
+
+            GFPolyDivider<GF>& root = _levels[top][0];
+            _quotient.resize(root.getQuotientCoef(numCoef));
+            root.divmod(pCoef, numCoef, &_quotient[0], &_current[0]);
+
+            size_t level = top;
+            for (; level > DIRECT_EVAL_LEVEL; level--)
+            {
+                std::vector<GFPolyDivider<GF> >& children = _levels[level - 1];
+                size_t parentCount = _levels[level].size();
+
+                for (size_t j = 0; j < children.size(); j++)
+                {
+                    size_t parentOffset = (j / 2) << level;
+                    size_t parentCoefs = pointsUnder(j / 2, level, parentCount);
+                    size_t childOffset = j << (level - 1);
+
+                    _quotient.resize(children[j].getQuotientCoef(parentCoefs));
+                    children[j].divmod(&_current[parentOffset], parentCoefs, &_quotient[0], &_next[childOffset]);
+                }
+
+                _current.swap(_next);
+            }
+
+            size_t nodeCount = _levels[level].size();
+            for (size_t j = 0; j < nodeCount; j++)
+            {
+                size_t offset = j << level;
+                size_t nodeCoefs = pointsUnder(j, level, nodeCount);
+
+                for (size_t i = offset; i < offset + nodeCoefs; i++)
+                {
+                    pValues[i] = horner(&_current[offset], nodeCoefs, _points[i]);
+                }
+            }
+        }
+
+        template<typename Alloc>
+        void evaluate(const GFPoly<GF, Alloc>& poly, std::vector<GF>& values)
+        {
+            values.resize(_points.size());
+            evaluate(&poly[0], poly.getNumCoef(), &values[0]);
+        }
+
+        /*
+         *  Evaluates at the points by the additive FFT, with workspace
+         *  for the values at every field element.  Returns false, doing
+         *  nothing, if the field has no FFT or there are too few points
+         *  for it to pay.
+         */
+        static bool evaluateByFFT(const GF *pCoef, size_t numCoef, const GF *pPoints, size_t numPoints, GF *pValues, std::vector<GF>& workspace)
+        {
+            if (FFT_EVAL_FRACTION * numPoints < GF::FIELD_SIZE || !GFFieldEvaluation<GF>::evaluate(pCoef, numCoef, workspace))
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < numPoints; i++)
+            {
+                pValues[i] = workspace[pPoints[i].toInt()];
+            }
+
+            return true;
+        }
+
+        /*
+         *  Finds the polynomial with fewer than getNumPoints() coefficients
+         *  that takes the specified values at the points, writing its
+         *  coefficients (lowest exponent first) to pCoef.  The points
+         *  must be distinct.
+         *
+         *  This is Lagrange interpolation:  with m the product of all the
+         *  (x - p(i)), the result is the sum of v(i) / m'(p(i)) times
+         *  m / (x - p(i)).  The sum is built from the leaves up - each
+         *  node combines its children as left * M(right) + right * M(left).
+         */
+        void interpolate(const GF *pValues, GF *pCoef)
+        {
+            size_t numPoints = _points.size();
+            if (_weights.empty())
+            {
+                computeWeights();
+            }
+
+            _current.resize(numPoints);
+            _next.resize(numPoints);
+            for (size_t i = 0; i < numPoints; i++)
+            {
+                _current[i] = pValues[i] * _weights[i];
+            }
+
+            for (size_t level = 1; level < _levels.size(); level++)
+            {
+                const std::vector<GFPolyDivider<GF> >& children = _levels[level - 1];
+                size_t parentCount = _levels[level].size();
+
+                for (size_t j = 0; j < parentCount; j++)
+                {
+                    size_t offset = j << level;
+                    size_t leftCoefs = pointsUnder(2 * j, level - 1, children.size());
+
+                    if (2 * j + 1 == children.size())
+                    {
+                        for (size_t i = offset; i < offset + leftCoefs; i++)
+                        {
+                            _next[i] = _current[i];
+                        }
+                        continue;
+                    }
+
+                    size_t rightOffset = offset + leftCoefs;
+                    size_t rightCoefs = pointsUnder(2 * j + 1, level - 1, children.size());
+                    const GFPolyDivider<GF>& left = children[2 * j];
+                    const GFPolyDivider<GF>& right = children[2 * j + 1];
+
+                    _multiplier.multiply(&_current[offset], leftCoefs, &right[0], right.getNumCoef(), &_next[offset]);
+                    _multiplier.multiplyAdd(&_current[rightOffset], rightCoefs, &left[0], left.getNumCoef(), &_next[offset]);
+                }
+
+                _current.swap(_next);
+            }
+
+            for (size_t i = 0; i < numPoints; i++)
+            {
+                pCoef[i] = _current[i];
+            }
+        }
+
+        template<typename Alloc>
+        void interpolate(const std::vector<GF>& values, GFPoly<GF, Alloc>& output)
+        {
+            output.resize(_points.size());
+            interpolate(&values[0], &output[0]);
+        }
+
+    private:
+        void build()
+        {
+            size_t numPoints = _points.size();
+
+            _levels.resize(1);
+            _levels[0].reserve(numPoints);
+            for (size_t i = 0; i < numPoints; i++)
+            {
+                GF leaf[2];
+                leaf[0] = -_points[i];
+                leaf[1] = GF(1);
+                _levels[0].push_back(GFPolyDivider<GF>(leaf, 2));
+            }
+
+            std::vector<GF> product;
+            while (_levels.back().size() > 1)
+            {
+                size_t level = _levels.size();
+                _levels.resize(level + 1);
+
+                const std::vector<GFPolyDivider<GF> >& children = _levels[level - 1];
+                std::vector<GFPolyDivider<GF> >& parents = _levels[level];
+                parents.reserve((children.size() + 1) / 2);
+
+                for (size_t j = 0; j + 1 < children.size(); j += 2)
+                {
+                    const GFPolyDivider<GF>& left = children[j];
+                    const GFPolyDivider<GF>& right = children[j + 1];
+
+                    product.resize(left.getNumCoef() + right.getNumCoef() - 1);
+                    _multiplier.multiply(&left[0], left.getNumCoef(), &right[0], right.getNumCoef(), &product[0]);
+                    parents.push_back(GFPolyDivider<GF>(&product[0], product.size()));
+                }
+
+                if (children.size() % 2 != 0)
+                {
+                    parents.push_back(children.back());
+                }
+            }
+        }
+
+        /*
+         *  weight(i) = 1 / m'(p(i)), where m is the root product.
+         */
+        void computeWeights()
+        {
+            GFPoly<GF> derivative = getProduct().derivative();
+
+            _weights.resize(_points.size());
+            evaluate(derivative, _weights);
+
+            for (size_t i = 0; i < _weights.size(); i++)
+            {
+                _weights[i] = GF(1) / _weights[i];
+            }
+        }
+
+        /*
+         *  Number of points under node j on the specified level, which
+         *  is also the number of coefficients in its remainder.
+         */
+        size_t pointsUnder(size_t j, size_t level, size_t nodeCount) const
+        {
+            if (j + 1 < nodeCount)
+            {
+                return static_cast<size_t>(1) << level;
+            }
+
+            return _points.size() - (j << level);
+        }
+
+        static GF horner(const GF *pCoef, size_t numCoef, const GF& value)
+        {
+            GF output;
+            for (size_t i = numCoef; i > 0; i--)
+            {
+                output = output * value + pCoef[i - 1];
+            }
+
+            return output;
+        }
+
+        std::vector<GF>                                 _points;
+        std::vector<std::vector<GFPolyDivider<GF> > >   _levels;
+        std::vector<GF>                                 _weights;
+        std::vector<GF>                                 _current;
+        std::vector<GF>                                 _next;
+        std::vector<GF>                                 _quotient;
+        std::vector<GF>                                 _fieldValues;   // FFT workspace
+        GFPolyMultiplier<GF>                            _multiplier;
+    };
+
+    /*
+     *  Evaluates a polynomial at each of the points.  When the same
+     *  points are used repeatedly, keep a GFPolySubproductTree instead,
+     *  unless the evaluation goes to the FFT, which needs no tree.
+     */
+    template<typename GF, typename Alloc>
+    std::vector<GF> evaluateAt(const GFPoly<GF, Alloc>& poly, const std::vector<GF>& points)
+    {
+        std::vector<GF> values(points.size());
+        std::vector<GF> workspace;
+        if (GFPolySubproductTree<GF>::evaluateByFFT(&poly[0], poly.getNumCoef(), &points[0], points.size(), &values[0], workspace))
+        {
+            return values;
+        }
+
+        GFPolySubproductTree<GF> tree(points);
+        tree.evaluate(poly, values);
+
+        return values;
+    }
+
+    /*
+     *  Finds the polynomial of degree less than points.size() that takes
+     *  the specified values at the points, which must be distinct.
+     */
+    template<typename GF>
+    GFPoly<GF> interpolate(const std::vector<GF>& points, const std::vector<GF>& values)
+    {
+        GFPolySubproductTree<GF> tree(points);
+        GFPoly<GF> output;
+        tree.interpolate(values, output);
+
+        return output;
+    }
+}
+
+#endif  // GFPOLYTREE_DOT_H
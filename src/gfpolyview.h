@@ -0,0 +1,177 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFPOLYVIEW_DOT_H
+#define GFPOLYVIEW_DOT_H
+
+#include <stddef.h>
+#include "gfpoly.h"
+#include "gfpolyexpr.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  Order of the coefficients in a caller's buffer.  HIGHEST_FIRST is
+     *  the order symbols are transmitted in (and the order the GFPoly
+     *  array constructors take.)
+     */
+    enum GFCoefOrder
+    {
+        HIGHEST_FIRST,
+        LOWEST_FIRST
+    };
+
+    /*
+     *  A polynomial whose coefficients live in memory owned by the caller,
+     *  one symbol per element of type T (typically uint8_t for GF(256) or
+     *  uint16_t for GF(929)), such as a network or file buffer.  Nothing
+     *  is copied or reversed - each symbol is read when needed, with the
+     *  field's fromReduced(), which does not reduce it modulo the field
+     *  size, so symbols must already be valid field elements.
+     *
+     *  A view is a polynomial expression (see gfpolyexpr.h), so it can be
+     *  used anywhere one is accepted:
+     *
+     *      GFPolyView<GF256, const uint8_t> message(pBuffer, 16);
+     *      prepared.remainder(message << 10, &remainder[0]);
+     *
+     *  If T is not const, an expression can also be assigned to the view,
+     *  writing the result straight back into the buffer.
+     */
+    template<typename GF, typename T>
+    class GFPolyView : public GFPolyExpr<GF, GFPolyView<GF, T> >
+    {
+    public:
+        GFPolyView(T *pData, size_t numCoef, GFCoefOrder order = HIGHEST_FIRST)
+            :   _pData(pData),
+                _numCoef(numCoef),
+                _order(order)
+        {
+        }
+
+        size_t getNumCoef() const
+        {
+            return _numCoef;
+        }
+
+        GF coef(size_t n) const
+        {
+            return GF::fromReduced(_pData[index(n)]);
+        }
+
+        void setCoef(size_t n, const GF& value)
+        {
+            _pData[index(n)] = static_cast<T>(value.toInt());
+        }
+
+        bool refersTo(const void *pBegin, const void *pEnd) const
+        {
+            return gfRangesOverlap(_pData, _pData + _numCoef, pBegin, pEnd);
+        }
+
+        /*
+         *  A view does not know how its order and symbol size line up
+         *  with the memory being written, so any overlap counts.
+         */
+        bool refersToShifted(const void *pBegin, const void *pEnd) const
+        {
+            return refersTo(pBegin, pEnd);
+        }
+
+        /*
+         *  Copying a view gives another view of the same buffer, as
+         *  expressions holding it by value need.  Assigning one view to
+         *  another copies the coefficients, not the buffer pointer - for
+         *  assignment a view behaves like a reference.
+         */
+        GFPolyView(const GFPolyView<GF, T>& other)
+            :   GFPolyExpr<GF, GFPolyView<GF, T> >(),
+                _pData(other._pData),
+                _numCoef(other._numCoef),
+                _order(other._order)
+        {
+        }
+
+        GFPolyView<GF, T>& operator=(const GFPolyView<GF, T>& other)
+        {
+            return *this = static_cast<const GFPolyExpr<GF, GFPolyView<GF, T> >&>(other);
+        }
+
+        /*
+         *  Writes an expression into the buffer.  The expression may have
+         *  fewer coefficients than the view (the rest are zeroed) but not
+         *  more.  If the expression reads any of this buffer - through
+         *  this view or another one overlapping it - it is evaluated into
+         *  a temporary first, since the two may be in different orders or
+         *  at different offsets.
+         */
+        template<typename E>
+        GFPolyView<GF, T>& operator=(const GFPolyExpr<GF, E>& expr)
+        {
+            const E& source = expr.self();
+
+            if (source.refersTo(_pData, _pData + _numCoef))
+            {
+                GFPoly<GF> temp(expr);
+                return *this = temp;
+            }
+
+            size_t count = source.getNumCoef();
+            for (size_t i = 0; i < _numCoef; i++)
+            {
+                setCoef(i, i < count ? source.coef(i) : GF(0));
+            }
+
+            return *this;
+        }
+
+        /*
+         *  Evaluate the polynomial at the specified value, by Horner's rule.
+         */
+        GF eval(const GF& value) const
+        {
+            GF output;
+            for (size_t i = _numCoef; i > 0; i--)
+            {
+                output = output * value + coef(i - 1);
+            }
+
+            return output;
+        }
+
+        T *data() const
+        {
+            return _pData;
+        }
+
+        GFCoefOrder getOrder() const
+        {
+            return _order;
+        }
+
+    private:
+        size_t index(size_t n) const
+        {
+            return _order == HIGHEST_FIRST ? _numCoef - 1 - n : n;
+        }
+
+        T           *_pData;
+        size_t      _numCoef;
+        GFCoefOrder _order;
+    };
+}
+
+#endif  // GFPOLYVIEW_DOT_H
@@ -50,6 +50,17 @@ namespace SilverBayTech
         {
         }
 
+        /*
+         *  Builds the element with a value that is already less than
+         *  SIZE.  Unlike the constructor, the value is not reduced.
+         */
+        static GFPrime<SIZE> fromReduced(uint32_t value)
+        {
+            GFPrime<SIZE> output;
+            output._value = value;
+            return output;
+        }
+
         /*
          *  Assignment operator.
          */
@@ -194,6 +205,12 @@ namespace SilverBayTech
 
         static const uint32_t FIELD_SIZE = SIZE;
 
+        /*
+         *  The characteristic of a prime field is its size.
+         *  (Used to reduce integer multiples, e.g. in formal derivatives.)
+         */
+        static const uint32_t CHARACTERISTIC = SIZE;
+
     private:
         /*
          *  This is the underlying value of an element.  A smaller data type
@@ -0,0 +1,340 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef GFSPARSEPOLY_DOT_H
+#define GFSPARSEPOLY_DOT_H
+
+#include <vector>
+#include <algorithm>
+#include <stddef.h>
+#include "gfpoly.h"
+#include "gfpolyexpr.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  One nonzero term of a sparse polynomial.
+     */
+    template<typename GF>
+    struct GFSparseTerm
+    {
+        GFSparseTerm()
+            :   exponent(0)
+        {
+        }
+
+        GFSparseTerm(size_t termExponent, const GF& termCoef)
+            :   exponent(termExponent),
+                coef(termCoef)
+        {
+        }
+
+        bool operator<(const GFSparseTerm<GF>& other) const
+        {
+            return exponent < other.exponent;
+        }
+
+        size_t  exponent;
+        GF      coef;
+    };
+
+    /*
+     *  A polynomial stored as its nonzero terms only, in increasing order
+     *  of exponent.  Generators of shortened and BCH codes and many error
+     *  locators have only a handful of terms, so multiplying by one or
+     *  reducing modulo one this way costs time proportional to the number
+     *  of terms rather than to the degree:
+     *
+     *      GFSparsePoly<GF> generator(denseGenerator);
+     *      GFPoly<GF> remainder = (message << n) % generator;
+     *
+     *  A sparse polynomial is also a polynomial expression (see
+     *  gfpolyexpr.h), so it can be compared with, printed as or assigned
+     *  to a dense GFPoly.  Looking up a single coefficient through that
+     *  interface is a binary search.
+     */
+    template<typename GF>
+    class GFSparsePoly : public GFPolyExpr<GF, GFSparsePoly<GF> >
+    {
+    public:
+        typedef GFSparseTerm<GF> Term;
+
+        /*
+         *  Constructor that builds the zero polynomial.
+         */
+        GFSparsePoly()
+        {
+        }
+
+        /*
+         *  Conversion from a dense polynomial, keeping the nonzero terms.
+         */
+        template<typename Alloc>
+        explicit GFSparsePoly(const GFPoly<GF, Alloc>& poly)
+        {
+            size_t numCoef = poly.getNumCoef();
+            for (size_t i = 0; i < numCoef; i++)
+            {
+                if (poly[i] != GF(0))
+                {
+                    _terms.push_back(Term(i, poly[i]));
+                }
+            }
+        }
+
+        /*
+         *  Adds c * x^exponent to the polynomial.
+         */
+        void addTerm(size_t exponent, const GF& c)
+        {
+            typename std::vector<Term>::iterator it = std::lower_bound(_terms.begin(), _terms.end(), Term(exponent, GF(0)));
+            if (it != _terms.end() && it->exponent == exponent)
+            {
+                it->coef += c;
+                if (it->coef == GF(0))
+                {
+                    _terms.erase(it);
+                }
+            }
+            else if (c != GF(0))
+            {
+                _terms.insert(it, Term(exponent, c));
+            }
+        }
+
+        size_t getNumTerms() const
+        {
+            return _terms.size();
+        }
+
+        const Term& term(size_t i) const
+        {
+            return _terms[i];
+        }
+
+        /*
+         *  Degree, or -1 for the zero polynomial.
+         */
+        int degree() const
+        {
+            return _terms.empty() ? -1 : static_cast<int>(_terms.back().exponent);
+        }
+
+        /*
+         *  Expression interface (see gfpolyexpr.h.)
+         */
+        size_t getNumCoef() const
+        {
+            return _terms.empty() ? 1 : _terms.back().exponent + 1;
+        }
+
+        GF coef(size_t n) const
+        {
+            typename std::vector<Term>::const_iterator it = std::lower_bound(_terms.begin(), _terms.end(), Term(n, GF(0)));
+            return (it != _terms.end() && it->exponent == n) ? it->coef : GF(0);
+        }
+
+        bool refersTo(const void *pBegin, const void *pEnd) const
+        {
+            const Term *pTerms = _terms.data();
+            return gfRangesOverlap(pTerms, pTerms + _terms.size(), pBegin, pEnd);
+        }
+
+        bool refersToShifted(const void *, const void *) const
+        {
+            return false;
+        }
+
+        /*
+         *  Evaluate the polynomial at the specified value.
+         */
+        GF eval(const GF& value) const
+        {
+            GF output;
+            for (size_t i = 0; i < _terms.size(); i++)
+            {
+                output += _terms[i].coef * value.pow(static_cast<uint32_t>(_terms[i].exponent));
+            }
+
+            return output;
+        }
+
+        /*
+         *  Computes pOutput += this * B, where pOutput has
+         *  degree() + numB coefficients.
+         */
+        void multiplyAdd(const GF *pB, size_t numB, GF *pOutput) const
+        {
+            for (size_t i = 0; i < _terms.size(); i++)
+            {
+                GF c = _terms[i].coef;
+                GF *pOut = pOutput + _terms[i].exponent;
+                for (size_t j = 0; j < numB; j++)
+                {
+                    pOut[j] += c * pB[j];
+                }
+            }
+        }
+
+        /*
+         *  Reduces the numCoef coefficients at pCoef (lowest exponent
+         *  first) modulo this polynomial, in place.  Afterwards the low
+         *  degree() coefficients hold the remainder and, if pQuotient is
+         *  given, it receives the numCoef - degree() quotient
+         *  coefficients.  The polynomial must be nonzero, and numCoef must
+         *  be at least degree().
+         */
+        void reduce(GF *pCoef, size_t numCoef, GF *pQuotient = 0) const
+        {
+            size_t d = _terms.back().exponent;
+            GF leadInverse = GF(1) / _terms.back().coef;
+            bool monic = (_terms.back().coef == GF(1));
+            size_t numLower = _terms.size() - 1;
+
+            for (size_t i = numCoef; i > d; i--)
+            {
+                size_t top = i - 1;
+                GF q = monic ? pCoef[top] : pCoef[top] * leadInverse;
+                if (pQuotient != 0)
+                {
+                    pQuotient[top - d] = q;
+                }
+                pCoef[top] = GF(0);
+
+                if (q == GF(0))
+                {
+                    continue;
+                }
+
+                GF *pBase = pCoef + (top - d);
+                for (size_t j = 0; j < numLower; j++)
+                {
+                    pBase[_terms[j].exponent] -= q * _terms[j].coef;
+                }
+            }
+        }
+
+    private:
+        std::vector<Term>   _terms;
+    };
+
+    /*
+     *  Sparse polynomials in expressions are referenced, not copied.
+     */
+    template<typename GF>
+    struct GFPolyExprOperand<GFSparsePoly<GF> >
+    {
+        typedef const GFSparsePoly<GF>& type;
+    };
+
+    /*
+     *  Sparse times dense, in time proportional to the number of terms
+     *  times the length of the dense polynomial.
+     */
+    template<typename GF, typename Alloc>
+    GFPoly<GF, Alloc> operator*(const GFSparsePoly<GF>& sparse, const GFPoly<GF, Alloc>& dense)
+    {
+        if (sparse.getNumTerms() == 0)
+        {
+            return GFPoly<GF, Alloc>(1, dense.getAllocator());
+        }
+
+        size_t denseCount = dense.getNumCoef();
+        GFPoly<GF, Alloc> output(sparse.getNumCoef() + denseCount - 1, dense.getAllocator());
+        sparse.multiplyAdd(&dense[0], denseCount, &output[0]);
+
+        return output;
+    }
+
+    template<typename GF, typename Alloc>
+    GFPoly<GF, Alloc> operator*(const GFPoly<GF, Alloc>& dense, const GFSparsePoly<GF>& sparse)
+    {
+        return sparse * dense;
+    }
+
+    /*
+     *  Sparse times sparse.
+     */
+    template<typename GF>
+    GFSparsePoly<GF> operator*(const GFSparsePoly<GF>& left, const GFSparsePoly<GF>& right)
+    {
+        GFSparsePoly<GF> output;
+        for (size_t i = 0; i < left.getNumTerms(); i++)
+        {
+            for (size_t j = 0; j < right.getNumTerms(); j++)
+            {
+                output.addTerm(left.term(i).exponent + right.term(j).exponent, left.term(i).coef * right.term(j).coef);
+            }
+        }
+
+        return output;
+    }
+
+    /*
+     *  Quotient and remainder of a dense polynomial divided by a nonzero
+     *  sparse one, in time proportional to the number of divisor terms
+     *  times the degree difference.  As with GFPoly, the remainder has
+     *  one coefficient fewer than the divisor.
+     */
+    template<typename GF, typename Alloc>
+    void divmod(const GFPoly<GF, Alloc>& dividend, const GFSparsePoly<GF>& divisor, GFPoly<GF, Alloc>& quotient, GFPoly<GF, Alloc>& remainder)
+    {
+        size_t d = static_cast<size_t>(divisor.degree());
+        size_t dividendCount = dividend.getNumCoef();
+
+        GFPoly<GF, Alloc> work(dividend);
+        if (dividendCount < d)
+        {
+            work.resize(d);
+        }
+
+        size_t quotientCount = dividendCount > d ? dividendCount - d : 1;
+        quotient = GFPoly<GF, Alloc>(quotientCount, quotient.getAllocator());
+        divisor.reduce(&work[0], work.getNumCoef(), &quotient[0]);
+
+        work.resize(d == 0 ? 1 : d);
+        remainder.swap(work);
+    }
+
+    template<typename GF, typename Alloc>
+    GFPoly<GF, Alloc> operator%(const GFPoly<GF, Alloc>& dividend, const GFSparsePoly<GF>& divisor)
+    {
+        size_t d = static_cast<size_t>(divisor.degree());
+
+        GFPoly<GF, Alloc> remainder(dividend);
+        if (remainder.getNumCoef() < d)
+        {
+            remainder.resize(d);
+        }
+
+        divisor.reduce(&remainder[0], remainder.getNumCoef());
+        remainder.resize(d == 0 ? 1 : d);
+
+        return remainder;
+    }
+
+    /*
+     *  Remainder of a polynomial expression, such as (message << n).
+     */
+    template<typename GF, typename E>
+    GFPoly<GF> operator%(const GFPolyExpr<GF, E>& dividend, const GFSparsePoly<GF>& divisor)
+    {
+        GFPoly<GF> materialized(dividend);
+        return materialized % divisor;
+    }
+}
+
+#endif  // GFSPARSEPOLY_DOT_H
@@ -0,0 +1,170 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef PDF417CODEWORDS_DOT_H
+#define PDF417CODEWORDS_DOT_H
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <stddef.h>
+#include <stdint.h>
+#include "gfprime.h"
+#include "rsencoder.h"
+#include "rsdecoder.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  The error correction layer of a PDF417 symbol.  Security level s
+     *  (0 to 8) appends 2^(s+1) error correction codewords to the data
+     *  codewords, from a Reed-Solomon code over GF(929) with generator
+     *  roots 3^1 ... 3^(2^(s+1)) - the code of rs929sample, which shows
+     *  level 1.  Data and error correction together hold at most 928
+     *  codewords.
+     *
+     *  The generator of each level is built once and shared, through
+     *  RSEncoder::get.  Decoding uses RSDecoder, whose syndromes, Chien
+     *  search and Forney evaluations run in SIMD lanes for GF(929) (see
+     *  rskernels.h.)
+     *
+     *  PDF417 keeps two error correction codewords for detection only:  e
+     *  erasures and t errors are corrected as long as
+     *  e + 2 t <= 2^(s+1) - 2, so level 0 detects errors but corrects
+     *  none.
+     *
+     *  encode may be called from several threads at once, but decode uses
+     *  the object's workspace - use one PDF417Codewords per thread for
+     *  decoding.  Like RSEncoder::get, the constructor must not run from
+     *  static initializers.
+     */
+    class PDF417Codewords
+    {
+    public:
+        typedef GFPrime<929> GF929;
+
+        static const size_t MAX_LEVEL = 8;
+        static const size_t MAX_CODEWORDS = 928;
+
+        /*
+         *  The level must be from 0 to MAX_LEVEL.
+         */
+        PDF417Codewords(size_t level)
+            :   _level(level),
+                _numEcc(getNumEcc(level)),
+                _pEncoder(RSEncoder<GF929>::get(getNumEcc(level), 1, GF929(3))),
+                _decoder(getNumEcc(level), 1, GF929(3)),
+                _received(MAX_CODEWORDS)
+        {
+        }
+
+        /*
+         *  Error correction codewords at the level.
+         */
+        static size_t getNumEcc(size_t level)
+        {
+            return static_cast<size_t>(2) << level;
+        }
+
+        /*
+         *  The lowest level the specification recommends for numData
+         *  data codewords.
+         */
+        static size_t getRecommendedLevel(size_t numData)
+        {
+            if (numData <= 40)
+            {
+                return 2;
+            }
+            if (numData <= 160)
+            {
+                return 3;
+            }
+            if (numData <= 320)
+            {
+                return 4;
+            }
+            return 5;
+        }
+
+        size_t getLevel() const
+        {
+            return _level;
+        }
+
+        size_t getNumEcc() const
+        {
+            return _numEcc;
+        }
+
+        size_t getMaxDataCodewords() const
+        {
+            return MAX_CODEWORDS - _numEcc;
+        }
+
+        /*
+         *  Computes the getNumEcc() error correction codewords for the
+         *  numData data codewords (at most getMaxDataCodewords(), each
+         *  below 929), which the symbol places after the data.
+         */
+        void encode(const uint16_t *pData, size_t numData, uint16_t *pEcc) const
+        {
+            _pEncoder->encode(pData, numData, pEcc);
+        }
+
+        /*
+         *  Corrects the data and error correction codewords in place,
+         *  given the indexes of any codewords known to be unreadable.  If
+         *  they cannot be corrected, within the margin described above,
+         *  they are left unchanged and RS_UNCORRECTABLE is returned.
+         */
+        RSDecodeStatus decode(uint16_t *pCodewords, size_t numCodewords, const size_t *pErasures = 0, size_t numErasures = 0)
+        {
+            if (numCodewords <= _numEcc || numCodewords > MAX_CODEWORDS)
+            {
+                return RS_INVALID_LENGTH;
+            }
+
+            std::copy(pCodewords, pCodewords + numCodewords, _received.begin());
+            RSDecodeStatus status = _decoder.decode(pCodewords, numCodewords, pErasures, numErasures);
+            if (status != RS_CORRECTED)
+            {
+                return status;
+            }
+
+            size_t numErrors = _decoder.getNumCorrected() - numErasures;
+            if (numErasures + 2 * numErrors + 2 > _numEcc)
+            {
+                std::copy(_received.begin(), _received.begin() + numCodewords, pCodewords);
+                return RS_UNCORRECTABLE;
+            }
+
+            return RS_CORRECTED;
+        }
+
+    private:
+        PDF417Codewords(const PDF417Codewords&);
+        PDF417Codewords& operator=(const PDF417Codewords&);
+
+        size_t                                    _level;
+        size_t                                    _numEcc;
+        std::shared_ptr<const RSEncoder<GF929> >  _pEncoder;
+        RSDecoder<GF929>                          _decoder;
+        std::vector<uint16_t>                     _received;
+    };
+}
+
+#endif  // PDF417CODEWORDS_DOT_H
@@ -0,0 +1,334 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef QRCODEWORDS_DOT_H
+#define QRCODEWORDS_DOT_H
+
+#include <vector>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include "eccThreadPool.h"
+#include "gfbinary.h"
+#include "rstableencoder.h"
+#include "rsbatchdecoder.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  QR Code error correction levels, recovering roughly 7%, 15%, 25%
+     *  and 30% of the codewords.
+     */
+    enum QREccLevel
+    {
+        QR_ECC_L,
+        QR_ECC_M,
+        QR_ECC_Q,
+        QR_ECC_H
+    };
+
+    /*
+     *  The error correction layer of a QR Code symbol:  the data
+     *  codewords are split into blocks, each block gets its own
+     *  Reed-Solomon parity over GF(256) (generator roots a^0, a^1 ...,
+     *  as in rs256sample), and the blocks are interleaved into the
+     *  final codeword sequence.
+     *
+     *  A symbol of each version (1 to 40) and level has b blocks with
+     *  the same number of parity codewords.  The last few blocks hold
+     *  one more data codeword than the rest.  The sequence is data
+     *  codeword 0 of every block, then data codeword 1 of every block,
+     *  and so on (the longer blocks supplying the last column alone),
+     *  followed by the parity interleaved the same way.
+     *
+     *  Encoding reads each block straight from the caller's data and
+     *  writes it straight to its interleaved positions, using the shared
+     *  RSTableEncoder for the block's parity.  Decoding gathers each
+     *  block, decodes all of them with an RSBatchDecoder - on a thread
+     *  pool, if one is given - and gives up as soon as any block fails.
+     */
+    class QRCodewords
+    {
+    public:
+        typedef GFBinary<256> GF256;
+
+        static const size_t MIN_VERSION = 1;
+        static const size_t MAX_VERSION = 40;
+
+        /*
+         *  The version must be from MIN_VERSION to MAX_VERSION (see
+         *  isValidVersion.)  Any other version gives an object with no
+         *  codewords, whose decode returns RS_INVALID_LENGTH.
+         */
+        QRCodewords(size_t version, QREccLevel level, EccThreadPool *pPool = 0)
+            :   _version(version),
+                _level(level),
+                _numBlocks(0),
+                _numEcc(0),
+                _numCodewords(0),
+                _numData(0),
+                _numShortBlocks(0),
+                _shortDataLength(0)
+        {
+            if (!isValidVersion(version))
+            {
+                return;
+            }
+
+            _numBlocks = tableNumBlocks(level, version);
+            _numEcc = tableNumEcc(level, version);
+            _numCodewords = rawCodewords(version);
+            _numData = _numCodewords - _numBlocks * _numEcc;
+            _numShortBlocks = _numBlocks - _numCodewords % _numBlocks;
+            _shortDataLength = _numCodewords / _numBlocks - _numEcc;
+
+            _pEncoder = RSTableEncoder::get(_numEcc, 0, GF256(2));
+            _pDecoder.reset(new RSBatchDecoder<GF256>(_numEcc, 0, GF256(2), pPool, 1));
+        }
+
+        static bool isValidVersion(size_t version)
+        {
+            return version >= MIN_VERSION && version <= MAX_VERSION;
+        }
+
+        size_t getVersion() const
+        {
+            return _version;
+        }
+
+        QREccLevel getLevel() const
+        {
+            return _level;
+        }
+
+        /*
+         *  Total codewords in the symbol, data and parity.
+         */
+        size_t getNumCodewords() const
+        {
+            return _numCodewords;
+        }
+
+        size_t getNumDataCodewords() const
+        {
+            return _numData;
+        }
+
+        size_t getNumBlocks() const
+        {
+            return _numBlocks;
+        }
+
+        /*
+         *  Parity codewords in each block.
+         */
+        size_t getNumEccPerBlock() const
+        {
+            return _numEcc;
+        }
+
+        /*
+         *  Data codewords in block k.
+         */
+        size_t getBlockDataLength(size_t k) const
+        {
+            return _shortDataLength + (k < _numShortBlocks ? 0 : 1);
+        }
+
+        /*
+         *  Encodes getNumDataCodewords() bytes of data into the
+         *  getNumCodewords() bytes of the final sequence.
+         */
+        void encode(const uint8_t *pData, uint8_t *pCodewords) const
+        {
+            uint8_t parity[RSTableEncoder::MAX_PARITY];
+            for (size_t k = 0; k < _numBlocks; k++)
+            {
+                const uint8_t *pBlock = pData + dataOffset(k);
+                size_t length = getBlockDataLength(k);
+                for (size_t i = 0; i < length; i++)
+                {
+                    pCodewords[dataIndex(k, i)] = pBlock[i];
+                }
+
+                _pEncoder->encode(pBlock, length, parity);
+                for (size_t j = 0; j < _numEcc; j++)
+                {
+                    pCodewords[eccIndex(k, j)] = parity[j];
+                }
+            }
+        }
+
+        /*
+         *  Recovers the getNumDataCodewords() bytes of data from the
+         *  final sequence, correcting each block.  pCodewords is not
+         *  changed.  Returns RS_UNCORRECTABLE, with pData unspecified, if
+         *  any block could not be corrected.  Safe to call from several
+         *  threads at once.
+         */
+        RSDecodeStatus decode(const uint8_t *pCodewords, uint8_t *pData)
+        {
+            if (_numBlocks == 0)
+            {
+                return RS_INVALID_LENGTH;
+            }
+
+            std::vector<uint8_t> blocks(_numCodewords);
+            uint8_t *blockPointers[MAX_BLOCKS];
+            size_t blockLengths[MAX_BLOCKS];
+            RSDecodeStatus results[MAX_BLOCKS];
+
+            for (size_t k = 0; k < _numBlocks; k++)
+            {
+                size_t length = getBlockDataLength(k);
+                uint8_t *pBlock = &blocks[dataOffset(k) + k * _numEcc];
+                for (size_t i = 0; i < length; i++)
+                {
+                    pBlock[i] = pCodewords[dataIndex(k, i)];
+                }
+                for (size_t j = 0; j < _numEcc; j++)
+                {
+                    pBlock[length + j] = pCodewords[eccIndex(k, j)];
+                }
+
+                blockPointers[k] = pBlock;
+                blockLengths[k] = length + _numEcc;
+            }
+
+            if (!_pDecoder->decodeBatch(blockPointers, blockLengths, _numBlocks, results, true))
+            {
+                return RS_UNCORRECTABLE;
+            }
+
+            RSDecodeStatus status = RS_NO_ERRORS;
+            for (size_t k = 0; k < _numBlocks; k++)
+            {
+                size_t length = getBlockDataLength(k);
+                uint8_t *pOutput = pData + dataOffset(k);
+                for (size_t i = 0; i < length; i++)
+                {
+                    pOutput[i] = blockPointers[k][i];
+                }
+
+                if (results[k] == RS_CORRECTED)
+                {
+                    status = RS_CORRECTED;
+                }
+            }
+
+            return status;
+        }
+
+    private:
+        QRCodewords(const QRCodewords&);
+        QRCodewords& operator=(const QRCodewords&);
+
+        static const size_t MAX_BLOCKS = 81;
+
+        /*
+         *  Offset of block k's data in the caller's data.
+         */
+        size_t dataOffset(size_t k) const
+        {
+            return k * _shortDataLength + (k < _numShortBlocks ? 0 : k - _numShortBlocks);
+        }
+
+        /*
+         *  Position of data codeword i of block k in the final sequence.
+         */
+        size_t dataIndex(size_t k, size_t i) const
+        {
+            if (i < _shortDataLength)
+            {
+                return i * _numBlocks + k;
+            }
+
+            return _shortDataLength * _numBlocks + k - _numShortBlocks;
+        }
+
+        size_t eccIndex(size_t k, size_t j) const
+        {
+            return _numData + j * _numBlocks + k;
+        }
+
+        /*
+         *  Codewords in a symbol:  the modules left after the finder,
+         *  timing and alignment patterns and the format and version
+         *  information, eight to a codeword.
+         */
+        static size_t rawCodewords(size_t version)
+        {
+            size_t modules = (16 * version + 128) * version + 64;
+            if (version >= 2)
+            {
+                size_t numAlign = version / 7 + 2;
+                modules -= (25 * numAlign - 10) * numAlign - 55;
+                if (version >= 7)
+                {
+                    modules -= 36;
+                }
+            }
+
+            return modules / 8;
+        }
+
+        /*
+         *  Parity codewords per block, from the QR Code specification,
+         *  indexed by level then version.
+         */
+        static size_t tableNumEcc(QREccLevel level, size_t version)
+        {
+            static const uint8_t TABLE[4][MAX_VERSION + 1] =
+            {
+                { 0,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22, 24, 28, 30, 28, 28, 28, 28, 30, 30, 26, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+                { 0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24, 28, 28, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28 },
+                { 0, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30, 24, 28, 28, 26, 30, 28, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 },
+                { 0, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24, 30, 28, 28, 26, 28, 30, 24, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30 }
+            };
+
+            return TABLE[level][version];
+        }
+
+        /*
+         *  Blocks per symbol, indexed the same way.
+         */
+        static size_t tableNumBlocks(QREccLevel level, size_t version)
+        {
+            static const uint8_t TABLE[4][MAX_VERSION + 1] =
+            {
+                { 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4, 4, 4, 4, 4, 6, 6, 6, 6, 7, 8, 8, 9, 9, 10, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25 },
+                { 0, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5, 5, 8, 9, 9, 10, 10, 11, 13, 14, 16, 17, 17, 18, 20, 21, 23, 25, 26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49 },
+                { 0, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8, 8, 10, 12, 16, 12, 17, 16, 18, 21, 20, 23, 23, 25, 27, 29, 34, 34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68 },
+                { 0, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25, 25, 34, 30, 32, 35, 37, 40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81 }
+            };
+
+            return TABLE[level][version];
+        }
+
+        size_t                                  _version;
+        QREccLevel                              _level;
+        size_t                                  _numBlocks;
+        size_t                                  _numEcc;
+        size_t                                  _numCodewords;
+        size_t                                  _numData;
+        size_t                                  _numShortBlocks;
+        size_t                                  _shortDataLength;
+        std::shared_ptr<const RSTableEncoder>   _pEncoder;
+        std::shared_ptr<RSBatchDecoder<GF256> > _pDecoder;
+    };
+}
+
+#endif  // QRCODEWORDS_DOT_H
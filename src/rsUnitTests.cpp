@@ -0,0 +1,850 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+/*
+ *  Unit tests for the Reed-Solomon encoder and decoder.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <assert.h>
+#include "eccCpuFeatures.h"
+#include "eccUtils.h"
+#include "gfbinary.h"
+#include "gfprime.h"
+#include "gfpoly.h"
+#include "rsencoder.h"
+#include "rstableencoder.h"
+#include "rssplitencoder.h"
+#include "rsbatchencoder.h"
+#include "rsdecoder.h"
+#include "rsbatchdecoder.h"
+#include "eccCommonUnitTests.h"
+
+using namespace SilverBayTech;
+using namespace std;
+
+typedef GFBinary<256> GF256;
+typedef GFPrime<929> GF929;
+typedef GFBinary<256, 0x12D> GFDM;
+typedef GFBinary<64, 0x43> GF64;
+typedef GFBinary<1024, 0x409> GF1024;
+typedef GFBinary<4096, 0x1069> GF4096;
+
+static const uint8_t INPUT_256[] = {0x10, 0x20, 0x0C, 0x56, 0x61, 0x80, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11, 0xEC, 0x11};
+static const uint16_t INPUT_929[] = {5, 453, 178, 121, 239};
+
+/*
+ *  Simple deterministic generator so the larger tests are repeatable.
+ */
+static uint32_t s_randomState = 54321;
+static uint32_t nextRandom(void)
+{
+    s_randomState = s_randomState * 1103515245 + 12345;
+    return s_randomState >> 8;
+}
+
+/*
+ *  The parity the samples compute:  -((message << n) % generator),
+ *  highest exponent first.
+ */
+template<typename GF, typename T>
+static std::vector<T> polynomialParity(const RSEncoder<GF>& encoder, const T *pMessage, size_t numMessage)
+{
+    GFPoly<GF> message(numMessage);
+    for (size_t i = 0; i < numMessage; i++)
+    {
+        message[numMessage - 1 - i] = GF(pMessage[i]);
+    }
+
+    size_t numParity = encoder.getNumParity();
+    GFPoly<GF> remainder = (message << numParity) % encoder.getGenerator();
+
+    std::vector<T> parity(numParity);
+    for (size_t j = 0; j < numParity; j++)
+    {
+        parity[j] = static_cast<T>((-remainder[numParity - 1 - j]).toInt());
+    }
+
+    return parity;
+}
+
+static void encoder_matchesSample256(void)
+{
+    RSEncoder<GF256> encoder(10, 0, GF256(2));
+    assert(encoder.getGenerator().getNumCoef() == 11);
+
+    std::vector<uint8_t> parity(10);
+    encoder.encode(INPUT_256, ARRAY_LENGTH(INPUT_256), &parity[0]);
+    assert(parity == polynomialParity(encoder, INPUT_256, ARRAY_LENGTH(INPUT_256)));
+
+    GFPoly<GF256> message(ARRAY_LENGTH(INPUT_256));
+    for (size_t i = 0; i < ARRAY_LENGTH(INPUT_256); i++)
+    {
+        message[ARRAY_LENGTH(INPUT_256) - 1 - i] = GF256(INPUT_256[i]);
+    }
+
+    GFPoly<GF256> codeword = encoder.encode(message);
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        assert(codeword.eval(GF256(2).pow(i)) == GF256(0));
+    }
+}
+
+static void encoder_matchesSample929(void)
+{
+    RSEncoder<GF929> encoder(4, 1, GF929(3));
+
+    std::vector<uint16_t> codeword(INPUT_929, INPUT_929 + ARRAY_LENGTH(INPUT_929));
+    codeword.resize(ARRAY_LENGTH(INPUT_929) + 4);
+    encoder.encode(&codeword[0], codeword.size());
+
+    std::vector<uint16_t> expected = polynomialParity(encoder, INPUT_929, ARRAY_LENGTH(INPUT_929));
+    assert(std::equal(expected.begin(), expected.end(), codeword.begin() + ARRAY_LENGTH(INPUT_929)));
+
+    GFPoly<GF929> poly(codeword.size());
+    for (size_t i = 0; i < codeword.size(); i++)
+    {
+        poly[codeword.size() - 1 - i] = GF929(codeword[i]);
+    }
+    for (uint32_t i = 1; i <= 4; i++)
+    {
+        assert(poly.eval(GF929(3).pow(i)) == GF929(0));
+    }
+}
+
+static void encoder_randomMessages(void)
+{
+    RSEncoder<GF256> encoder(32, 1, GF256(2));
+    for (size_t trial = 0; trial < 20; trial++)
+    {
+        std::vector<uint8_t> message(1 + nextRandom() % 223);
+        for (size_t i = 0; i < message.size(); i++)
+        {
+            message[i] = static_cast<uint8_t>(nextRandom());
+        }
+
+        std::vector<uint8_t> parity(32);
+        encoder.encode(&message[0], message.size(), &parity[0]);
+        assert(parity == polynomialParity(encoder, &message[0], message.size()));
+    }
+}
+
+static void encoder_sharedAcrossThreads(void)
+{
+    std::shared_ptr<const RSEncoder<GF256> > first = RSEncoder<GF256>::get(10, 0, GF256(2));
+    assert(RSEncoder<GF256>::get(10, 0, GF256(2)) == first);
+    assert(RSEncoder<GF256>::get(10, 1, GF256(2)) != first);
+    assert(RSEncoder<GF256>::get(12, 0, GF256(2)) != first);
+
+    std::vector<uint8_t> expected(10);
+    first->encode(INPUT_256, ARRAY_LENGTH(INPUT_256), &expected[0]);
+
+    static const size_t NUM_THREADS = 4;
+    std::vector<std::vector<uint8_t> > results(NUM_THREADS, std::vector<uint8_t>(10));
+    std::vector<std::shared_ptr<const RSEncoder<GF256> > > encoders(NUM_THREADS);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NUM_THREADS; t++)
+    {
+        threads.push_back(std::thread([t, &results, &encoders]()
+        {
+            encoders[t] = RSEncoder<GF256>::get(10, 0, GF256(2));
+            for (size_t i = 0; i < 100; i++)
+            {
+                encoders[t]->encode(INPUT_256, ARRAY_LENGTH(INPUT_256), &results[t][0]);
+            }
+        }));
+    }
+    for (size_t t = 0; t < NUM_THREADS; t++)
+    {
+        threads[t].join();
+        assert(encoders[t] == first);
+        assert(results[t] == expected);
+    }
+}
+
+static void tableEncoder_matchesPolynomialParity(void)
+{
+    static const size_t NUM_PARITY[] = { 1, 2, 7, 8, 9, 10, 16, 30, 68 };
+    static const size_t LENGTHS[] = { 1, 5, 8, 16, 17, 100, 187 };
+
+    for (size_t p = 0; p < ARRAY_LENGTH(NUM_PARITY); p++)
+    {
+        RSEncoder<GF256> encoder(NUM_PARITY[p], 0, GF256(2));
+        RSTableEncoder tableEncoder(encoder);
+
+        for (size_t l = 0; l < ARRAY_LENGTH(LENGTHS); l++)
+        {
+            std::vector<uint8_t> message(LENGTHS[l]);
+            for (size_t i = 0; i < message.size(); i++)
+            {
+                message[i] = static_cast<uint8_t>(nextRandom());
+            }
+
+            std::vector<uint8_t> parity(NUM_PARITY[p]);
+            tableEncoder.encode(&message[0], message.size(), &parity[0]);
+            assert(parity == polynomialParity(encoder, &message[0], message.size()));
+        }
+    }
+
+    RSTableEncoder sampleEncoder(*RSEncoder<GF256>::get(10, 0, GF256(2)));
+    std::vector<uint8_t> codeword(INPUT_256, INPUT_256 + ARRAY_LENGTH(INPUT_256));
+    codeword.resize(codeword.size() + 10);
+    sampleEncoder.encode(&codeword[0], codeword.size());
+
+    std::vector<uint8_t> expected(10);
+    RSEncoder<GF256>::get(10, 0, GF256(2))->encode(INPUT_256, ARRAY_LENGTH(INPUT_256), &expected[0]);
+    assert(std::equal(expected.begin(), expected.end(), codeword.begin() + ARRAY_LENGTH(INPUT_256)));
+}
+
+/*
+ *  With no parity symbols there are no tables, and encoding leaves the
+ *  codeword as it is.
+ */
+static void tableEncoder_zeroParity(void)
+{
+    std::shared_ptr<const RSTableEncoder> pEncoder = RSTableEncoder::get(0, 0, GF256(2));
+    assert(pEncoder->getNumParity() == 0);
+
+    std::vector<uint8_t> codeword(20);
+    for (size_t i = 0; i < codeword.size(); i++)
+    {
+        codeword[i] = static_cast<uint8_t>(nextRandom());
+    }
+    std::vector<uint8_t> expected(codeword);
+
+    pEncoder->encode(&codeword[0], codeword.size());
+    assert(codeword == expected);
+}
+
+static void tableEncoder_sharedInstances(void)
+{
+    std::shared_ptr<const RSTableEncoder> pFirst = RSTableEncoder::get(16, 0, GF256(2));
+    std::shared_ptr<const RSTableEncoder> pSecond = RSTableEncoder::get(16, 0, GF256(2));
+    std::shared_ptr<const RSTableEncoder> pOther = RSTableEncoder::get(16, 1, GF256(2));
+
+    assert(pFirst == pSecond);
+    assert(pFirst != pOther);
+    assert(pFirst->getNumParity() == 16);
+    assert(RSTableEncoder::get(16, 0, GFDM(2)) != pFirst);
+}
+
+/*
+ *  The table and batch encoders over the Data Matrix field, next to
+ *  the QR Code field in the same process.
+ */
+static void encoders_otherPolynomial(void)
+{
+    RSEncoder<GFDM> encoder(28, 1, GFDM(2));
+    RSTableEncoder tableEncoder(encoder);
+    RSBatchEncoder batchEncoder(encoder);
+    std::shared_ptr<const RSTableEncoder> pQrEncoder = RSTableEncoder::get(28, 1, GF256(2));
+
+    std::vector<std::vector<uint8_t> > messages(20, std::vector<uint8_t>(44));
+    std::vector<std::vector<uint8_t> > parity(20, std::vector<uint8_t>(28));
+    std::vector<const uint8_t *> pMessages;
+    std::vector<uint8_t *> pParity;
+    for (size_t k = 0; k < messages.size(); k++)
+    {
+        for (size_t i = 0; i < messages[k].size(); i++)
+        {
+            messages[k][i] = static_cast<uint8_t>(nextRandom());
+        }
+        pMessages.push_back(&messages[k][0]);
+        pParity.push_back(&parity[k][0]);
+    }
+
+    batchEncoder.encodeBatch(&pMessages[0], 44, messages.size(), &pParity[0]);
+    for (size_t k = 0; k < messages.size(); k++)
+    {
+        std::vector<uint8_t> expected = polynomialParity(encoder, &messages[k][0], 44);
+        assert(parity[k] == expected);
+
+        std::vector<uint8_t> tableParity(28);
+        tableEncoder.encode(&messages[k][0], 44, &tableParity[0]);
+        assert(tableParity == expected);
+
+        pQrEncoder->encode(&messages[k][0], 44, &tableParity[0]);
+        assert(tableParity != expected);
+    }
+}
+
+template<unsigned int SIZE, unsigned int POLYNOMIAL>
+static void checkSplitEncoder(size_t numParity, size_t numMessage)
+{
+    typedef GFBinary<SIZE, POLYNOMIAL> GF;
+
+    RSEncoder<GF> encoder(numParity, 1, GF(2));
+    RSSplitEncoder<SIZE, POLYNOMIAL> splitEncoder(encoder);
+
+    std::vector<uint16_t> message(numMessage);
+    for (size_t i = 0; i < message.size(); i++)
+    {
+        message[i] = static_cast<uint16_t>(nextRandom() % SIZE);
+    }
+
+    std::vector<uint16_t> parity(numParity);
+    splitEncoder.encode(&message[0], message.size(), &parity[0]);
+    assert(parity == polynomialParity(encoder, &message[0], message.size()));
+}
+
+/*
+ *  The split-table encoder over the Aztec fields, with parity that does
+ *  and does not fill its last word.
+ */
+static void splitEncoder_matchesPolynomialParity(void)
+{
+    static const size_t NUM_PARITY[] = { 1, 3, 4, 5, 12 };
+
+    for (size_t p = 0; p < ARRAY_LENGTH(NUM_PARITY); p++)
+    {
+        checkSplitEncoder<16, 0x13>(NUM_PARITY[p], 10);
+        checkSplitEncoder<64, 0x43>(NUM_PARITY[p], 40);
+        checkSplitEncoder<256, 0x12D>(NUM_PARITY[p], 200);
+        checkSplitEncoder<1024, 0x409>(NUM_PARITY[p], 300);
+        checkSplitEncoder<4096, 0x1069>(NUM_PARITY[p], 300);
+    }
+
+    checkSplitEncoder<1024, 0x409>(240, 780);
+    checkSplitEncoder<4096, 0x1069>(401, 1263);
+
+    typedef RSSplitEncoder<4096, 0x1069> SplitEncoder4096;
+    std::shared_ptr<const SplitEncoder4096> pFirst = SplitEncoder4096::get(30, 1, GF4096(2));
+    assert(SplitEncoder4096::get(30, 1, GF4096(2)) == pFirst);
+    assert(SplitEncoder4096::get(31, 1, GF4096(2)) != pFirst);
+    assert(pFirst->getNumParity() == 30);
+}
+
+static void batchEncoder_matchesPolynomialParity(void)
+{
+    static const size_t NUM_PARITY[] = { 1, 10, 16, 20, 35 };
+    static const size_t NUM_MESSAGES[] = { 1, 16, 37 };
+    static const size_t LENGTHS[] = { 3, 16, 45 };
+
+    for (size_t p = 0; p < ARRAY_LENGTH(NUM_PARITY); p++)
+    {
+        RSEncoder<GF256> encoder(NUM_PARITY[p], 0, GF256(2));
+        RSBatchEncoder batchEncoder(encoder);
+
+        for (size_t m = 0; m < ARRAY_LENGTH(NUM_MESSAGES); m++)
+        {
+            for (size_t l = 0; l < ARRAY_LENGTH(LENGTHS); l++)
+            {
+                size_t numMessages = NUM_MESSAGES[m];
+                std::vector<std::vector<uint8_t> > messages(numMessages, std::vector<uint8_t>(LENGTHS[l]));
+                std::vector<std::vector<uint8_t> > parity(numMessages, std::vector<uint8_t>(NUM_PARITY[p]));
+                std::vector<const uint8_t *> pMessages;
+                std::vector<uint8_t *> pParity;
+                for (size_t k = 0; k < numMessages; k++)
+                {
+                    for (size_t i = 0; i < LENGTHS[l]; i++)
+                    {
+                        messages[k][i] = static_cast<uint8_t>(nextRandom());
+                    }
+                    pMessages.push_back(&messages[k][0]);
+                    pParity.push_back(&parity[k][0]);
+                }
+
+                batchEncoder.encodeBatch(&pMessages[0], LENGTHS[l], numMessages, &pParity[0]);
+                for (size_t k = 0; k < numMessages; k++)
+                {
+                    assert(parity[k] == polynomialParity(encoder, &messages[k][0], LENGTHS[l]));
+                }
+            }
+        }
+    }
+
+    RSBatchEncoder sampleEncoder(*RSEncoder<GF256>::get(10, 0, GF256(2)));
+    std::vector<uint8_t> codewords;
+    for (size_t k = 0; k < 20; k++)
+    {
+        codewords.insert(codewords.end(), INPUT_256, INPUT_256 + ARRAY_LENGTH(INPUT_256));
+        codewords.resize(codewords.size() + 10);
+    }
+    sampleEncoder.encodeBatch(&codewords[0], ARRAY_LENGTH(INPUT_256) + 10, 20);
+
+    std::vector<uint8_t> expected = polynomialParity(*RSEncoder<GF256>::get(10, 0, GF256(2)), INPUT_256, ARRAY_LENGTH(INPUT_256));
+    for (size_t k = 0; k < 20; k++)
+    {
+        std::vector<uint8_t>::const_iterator parity = codewords.begin() + (k + 1) * (ARRAY_LENGTH(INPUT_256) + 10) - 10;
+        assert(std::equal(expected.begin(), expected.end(), parity));
+    }
+}
+
+/*
+ *  Encodes a random message into a codeword of numCodeword symbols.
+ */
+template<typename GF, typename T>
+static std::vector<T> randomCodeword(const RSEncoder<GF>& encoder, size_t numCodeword)
+{
+    std::vector<T> codeword(numCodeword);
+    for (size_t i = 0; i + encoder.getNumParity() < numCodeword; i++)
+    {
+        codeword[i] = static_cast<T>(nextRandom() % GF::FIELD_SIZE);
+    }
+    encoder.encode(&codeword[0], numCodeword);
+
+    return codeword;
+}
+
+/*
+ *  Adds nonzero errors at numErrors distinct positions, returned in
+ *  increasing order.
+ */
+template<typename GF, typename T>
+static std::vector<size_t> addErrors(std::vector<T>& codeword, size_t numErrors)
+{
+    std::vector<size_t> positions;
+    while (positions.size() < numErrors)
+    {
+        size_t position = nextRandom() % codeword.size();
+        if (std::find(positions.begin(), positions.end(), position) == positions.end())
+        {
+            positions.push_back(position);
+        }
+    }
+    std::sort(positions.begin(), positions.end());
+
+    for (size_t k = 0; k < numErrors; k++)
+    {
+        GF error(nextRandom() % (GF::FIELD_SIZE - 1) + 1);
+        codeword[positions[k]] = static_cast<T>((GF(codeword[positions[k]]) + error).toInt());
+    }
+
+    return positions;
+}
+
+template<typename GF, typename T>
+static void checkDecoderCorrects(size_t numParity, uint32_t firstRoot, const GF& primitive, size_t numCodeword)
+{
+    RSEncoder<GF> encoder(numParity, firstRoot, primitive);
+    RSDecoder<GF> decoder(numParity, firstRoot, primitive);
+
+    for (size_t numErrors = 0; numErrors <= numParity / 2; numErrors++)
+    {
+        std::vector<T> original = randomCodeword<GF, T>(encoder, numCodeword);
+        std::vector<T> received(original);
+        std::vector<size_t> positions = addErrors<GF, T>(received, numErrors);
+
+        RSDecodeStatus status = decoder.decode(&received[0], received.size());
+        assert(status == (numErrors == 0 ? RS_NO_ERRORS : RS_CORRECTED));
+        assert(received == original);
+        assert(decoder.getNumCorrected() == numErrors);
+        for (size_t k = 0; k < numErrors; k++)
+        {
+            assert(decoder.getCorrectedPosition(k) == positions[k]);
+        }
+    }
+}
+
+static void decoder_correctsUpToCapacity(void)
+{
+    checkDecoderCorrects<GF256, uint8_t>(10, 0, GF256(2), 26);
+    checkDecoderCorrects<GF256, uint8_t>(32, 1, GF256(2), 255);
+    checkDecoderCorrects<GF256, uint8_t>(7, 112, GF256(2), 40);
+    checkDecoderCorrects<GF929, uint16_t>(4, 1, GF929(3), 9);
+    checkDecoderCorrects<GF929, uint16_t>(64, 1, GF929(3), 928);
+    checkDecoderCorrects<GFDM, uint8_t>(62, 1, GFDM(2), 218);
+    checkDecoderCorrects<GF64, uint8_t>(12, 1, GF64(2), 48);
+    checkDecoderCorrects<GF1024, uint16_t>(60, 1, GF1024(2), 1020);
+    checkDecoderCorrects<GF4096, uint16_t>(100, 1, GF4096(2), 1664);
+}
+
+static void decoder_beyondCapacity(void)
+{
+    RSEncoder<GF256> encoder(10, 0, GF256(2));
+    RSDecoder<GF256> decoder(10, 0, GF256(2));
+
+    size_t numDetected = 0;
+    for (size_t trial = 0; trial < 50; trial++)
+    {
+        std::vector<uint8_t> received = randomCodeword<GF256, uint8_t>(encoder, 40);
+        addErrors<GF256, uint8_t>(received, 6 + trial % 5);
+        std::vector<uint8_t> copy(received);
+
+        RSDecodeStatus status = decoder.decode(&received[0], received.size());
+        if (status == RS_UNCORRECTABLE)
+        {
+            assert(received == copy);
+            numDetected++;
+        }
+        else
+        {
+            assert(status == RS_CORRECTED);
+            assert(decoder.decode(&received[0], received.size()) == RS_NO_ERRORS);
+        }
+    }
+
+    assert(numDetected > 40);
+}
+
+static void decoder_invalidLength(void)
+{
+    RSDecoder<GF256> decoder(10, 0, GF256(2));
+    std::vector<uint8_t> codeword(300);
+
+    assert(decoder.decode(&codeword[0], 10) == RS_INVALID_LENGTH);
+    assert(decoder.decode(&codeword[0], 256) == RS_INVALID_LENGTH);
+    assert(decoder.decode(&codeword[0], 255) == RS_NO_ERRORS);
+}
+
+/*
+ *  Corrupts the codeword with numErasures + numErrors errors and erases a
+ *  random numErasures of them.
+ */
+template<typename GF, typename T>
+static void checkDecoderCorrectsErasures(size_t numParity, uint32_t firstRoot, const GF& primitive, size_t numCodeword)
+{
+    RSEncoder<GF> encoder(numParity, firstRoot, primitive);
+    RSDecoder<GF> decoder(numParity, firstRoot, primitive);
+
+    for (size_t numErasures = 1; numErasures <= numParity; numErasures += 3)
+    {
+        size_t numErrors = (numParity - numErasures) / 2;
+        std::vector<T> original = randomCodeword<GF, T>(encoder, numCodeword);
+        std::vector<T> received(original);
+        std::vector<size_t> positions = addErrors<GF, T>(received, numErrors + numErasures);
+
+        std::vector<size_t> erasures(positions);
+        for (size_t k = erasures.size(); k > 1; k--)
+        {
+            std::swap(erasures[k - 1], erasures[nextRandom() % k]);
+        }
+        erasures.resize(numErasures);
+
+        RSDecodeStatus status = decoder.decode(&received[0], received.size(), &erasures[0], erasures.size());
+        assert(status == RS_CORRECTED);
+        assert(received == original);
+        assert(decoder.getNumCorrected() == positions.size());
+        for (size_t k = 0; k < positions.size(); k++)
+        {
+            assert(decoder.getCorrectedPosition(k) == positions[k]);
+        }
+    }
+}
+
+static void decoder_correctsErrorsAndErasures(void)
+{
+    checkDecoderCorrectsErasures<GF256, uint8_t>(10, 0, GF256(2), 26);
+    checkDecoderCorrectsErasures<GF256, uint8_t>(32, 1, GF256(2), 255);
+    checkDecoderCorrectsErasures<GF929, uint16_t>(8, 1, GF929(3), 30);
+    checkDecoderCorrectsErasures<GF929, uint16_t>(64, 1, GF929(3), 928);
+    checkDecoderCorrectsErasures<GFDM, uint8_t>(28, 1, GFDM(2), 72);
+    checkDecoderCorrectsErasures<GF1024, uint16_t>(40, 1, GF1024(2), 500);
+    checkDecoderCorrectsErasures<GF4096, uint16_t>(64, 1, GF4096(2), 1664);
+}
+
+/*
+ *  Only erasures, some of which hold the right value, filling every
+ *  parity symbol.
+ */
+static void decoder_erasuresOnly(void)
+{
+    RSEncoder<GF929> encoder(10, 1, GF929(3));
+    RSDecoder<GF929> decoder(10, 1, GF929(3));
+
+    std::vector<uint16_t> original = randomCodeword<GF929, uint16_t>(encoder, 50);
+    std::vector<uint16_t> received(original);
+    std::vector<size_t> erasures;
+    for (size_t k = 0; k < 10; k++)
+    {
+        erasures.push_back(49 - 5 * k);
+        if (k % 3 != 0)
+        {
+            received[49 - 5 * k] = 0;
+        }
+    }
+
+    assert(decoder.decode(&received[0], received.size(), &erasures[0], erasures.size()) == RS_CORRECTED);
+    assert(received == original);
+    assert(decoder.getNumCorrected() == 10);
+    assert(decoder.getCorrectedPosition(0) == 4);
+}
+
+static void decoder_invalidErasures(void)
+{
+    RSDecoder<GF256> decoder(4, 0, GF256(2));
+    std::vector<uint8_t> codeword(20);
+    size_t repeated[] = { 3, 7, 3 };
+    size_t outOfRange[] = { 20 };
+    size_t tooMany[] = { 0, 1, 2, 3, 4 };
+
+    assert(decoder.decode(&codeword[0], codeword.size(), repeated, ARRAY_LENGTH(repeated)) == RS_INVALID_ERASURES);
+    assert(decoder.decode(&codeword[0], codeword.size(), outOfRange, ARRAY_LENGTH(outOfRange)) == RS_INVALID_ERASURES);
+    assert(decoder.decode(&codeword[0], codeword.size(), tooMany, ARRAY_LENGTH(tooMany)) == RS_UNCORRECTABLE);
+    assert(decoder.decode(&codeword[0], codeword.size(), tooMany, 4) == RS_NO_ERRORS);
+}
+
+/*
+ *  Damages each codeword with anything from no errors to a few past
+ *  capacity, so the batch mixes every outcome.
+ */
+template<typename GF, typename T>
+static void checkBatchMatchesSerial(RSBatchDecoder<GF>& batchDecoder, const RSEncoder<GF>& encoder, size_t numCodewords, bool contiguous)
+{
+    size_t numParity = encoder.getNumParity();
+    RSDecoder<GF> decoder(numParity, encoder.getFirstRoot(), encoder.getPrimitive());
+
+    std::vector<std::vector<T> > received(numCodewords);
+    std::vector<std::vector<T> > expected(numCodewords);
+    std::vector<RSDecodeStatus> expectedResults(numCodewords);
+    for (size_t k = 0; k < numCodewords; k++)
+    {
+        size_t numCodeword = contiguous ? 60 : numParity + 1 + k % 50;
+        received[k] = randomCodeword<GF, T>(encoder, numCodeword);
+        addErrors<GF, T>(received[k], k % (numParity / 2 + 3));
+
+        expected[k] = received[k];
+        expectedResults[k] = decoder.decode(&expected[k][0], numCodeword);
+    }
+
+    std::vector<RSDecodeStatus> results(numCodewords);
+    if (contiguous)
+    {
+        std::vector<T> buffer;
+        for (size_t k = 0; k < numCodewords; k++)
+        {
+            buffer.insert(buffer.end(), received[k].begin(), received[k].end());
+        }
+
+        batchDecoder.decodeBatch(&buffer[0], 60, numCodewords, &results[0]);
+        for (size_t k = 0; k < numCodewords; k++)
+        {
+            assert(std::equal(expected[k].begin(), expected[k].end(), buffer.begin() + 60 * k));
+        }
+    }
+    else
+    {
+        std::vector<T *> codewords(numCodewords);
+        std::vector<size_t> lengths(numCodewords);
+        for (size_t k = 0; k < numCodewords; k++)
+        {
+            codewords[k] = &received[k][0];
+            lengths[k] = received[k].size();
+        }
+
+        batchDecoder.decodeBatch(&codewords[0], &lengths[0], numCodewords, &results[0]);
+        assert(received == expected);
+    }
+
+    assert(results == expectedResults);
+}
+
+static void batchDecoder_matchesSerial(void)
+{
+    EccThreadPool pool(3);
+
+    RSEncoder<GF256> encoder256(16, 0, GF256(2));
+    RSBatchDecoder<GF256> pooled256(16, 0, GF256(2), &pool, 8);
+    checkBatchMatchesSerial<GF256, uint8_t>(pooled256, encoder256, 300, true);
+    checkBatchMatchesSerial<GF256, uint8_t>(pooled256, encoder256, 5, true);
+
+    RSEncoder<GF929> encoder929(6, 1, GF929(3));
+    RSBatchDecoder<GF929> pooled929(6, 1, GF929(3), &pool, 4);
+    checkBatchMatchesSerial<GF929, uint16_t>(pooled929, encoder929, 100, false);
+
+    RSBatchDecoder<GF929> serial929(6, 1, GF929(3));
+    checkBatchMatchesSerial<GF929, uint16_t>(serial929, encoder929, 40, false);
+
+    std::vector<uint8_t> codewords;
+    for (size_t k = 0; k < 4; k++)
+    {
+        std::vector<uint8_t> codeword = randomCodeword<GF256, uint8_t>(encoder256, 40);
+        addErrors<GF256, uint8_t>(codeword, k == 1 ? 12 : 1);
+        codewords.insert(codewords.end(), codeword.begin(), codeword.end());
+    }
+
+    RSBatchDecoder<GF256> serial256(16, 0, GF256(2));
+    RSDecodeStatus results[4];
+    assert(!serial256.decodeBatch(&codewords[0], 40, 4, results, true));
+    assert(results[0] == RS_CORRECTED && results[1] == RS_UNCORRECTABLE);
+    assert(results[2] == RS_SKIPPED && results[3] == RS_SKIPPED);
+}
+
+template<typename GF>
+static void checkChienKernel(size_t numParity, const GF& primitive, size_t numCodeword)
+{
+    RSDecoderKernels<GF> kernels(numParity, 0, primitive.log());
+    for (size_t degree = 1; degree <= numParity / 2 && degree <= numCodeword; degree += 5)
+    {
+        std::vector<size_t> expected;
+        while (expected.size() < degree)
+        {
+            size_t position = nextRandom() % numCodeword;
+            if (std::find(expected.begin(), expected.end(), position) == expected.end())
+            {
+                expected.push_back(position);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+
+        GFPoly<GF> locator(1);
+        locator[0] = GF(1);
+        for (size_t k = 0; k < degree; k++)
+        {
+            GFPoly<GF> factor(2);
+            factor[0] = GF(1);
+            factor[1] = -primitive.pow(static_cast<uint32_t>(numCodeword - 1 - expected[k]));
+            locator = locator * factor;
+        }
+
+        std::vector<size_t> positions(degree);
+        std::vector<uint32_t> exponents(degree);
+        size_t found = 0;
+        bool ran = kernels.chienSearch(&locator[0], degree, numCodeword, &positions[0], &exponents[0], found);
+        assert(ran || !EccCpuFeatures::hasSsse3());
+        if (ran)
+        {
+            assert(found == degree);
+            assert(positions == expected);
+            assert(exponents[0] == numCodeword - 1 - expected[0]);
+        }
+    }
+}
+
+static void chienKernel_findsKnownRoots(void)
+{
+    checkChienKernel(32, GF256(2), 255);
+    checkChienKernel(32, GF256(2), 40);
+    checkChienKernel(32, GF256(2), 16);
+    checkChienKernel(32, GF256(2), 17);
+    checkChienKernel(64, GF929(3), 928);
+    checkChienKernel(64, GF929(3), 101);
+    checkChienKernel(16, GF929(3), 13);
+    checkChienKernel(32, GFDM(2), 255);
+    checkChienKernel(12, GF64(2), 63);
+    checkChienKernel(64, GF1024(2), 1020);
+    checkChienKernel(64, GF4096(2), 1664);
+    checkChienKernel(16, GF4096(2), 21);
+}
+
+/*
+ *  The kernels' polynomial evaluation, where they have one, against
+ *  Horner's rule.  Polynomials of minCoef coefficients or more must
+ *  take the kernel on a processor with SSSE3.
+ */
+template<typename GF>
+static void checkEvaluateKernel(const GF& primitive, size_t minCoef)
+{
+    static const size_t NUM_COEF[] = { 4, 31, 32, 33, 47, 48, 49, 100, 512 };
+
+    RSDecoderKernels<GF> kernels(512, 1, primitive.log());
+    for (size_t c = 0; c < ARRAY_LENGTH(NUM_COEF); c++)
+    {
+        std::vector<GF> coefs(NUM_COEF[c]);
+        for (size_t i = 0; i < coefs.size(); i++)
+        {
+            coefs[i] = GF(nextRandom() % GF::FIELD_SIZE);
+        }
+
+        for (size_t trial = 0; trial < 4; trial++)
+        {
+            GF x(nextRandom() % GF::FIELD_SIZE);
+            GF expected;
+            for (size_t i = coefs.size(); i > 0; i--)
+            {
+                expected = expected * x + coefs[i - 1];
+            }
+
+            GF value;
+            bool ran = kernels.evaluate(&coefs[0], coefs.size(), x, value);
+            assert(ran || !EccCpuFeatures::hasSsse3() || coefs.size() < minCoef);
+            if (ran)
+            {
+                assert(value == expected);
+            }
+        }
+    }
+}
+
+static void evaluateKernel_matchesHorner(void)
+{
+    checkEvaluateKernel(GF929(3), 32);
+    checkEvaluateKernel(GF1024(2), 48);
+    checkEvaluateKernel(GF4096(2), 48);
+}
+
+/*
+ *  The kernels' syndromes against evaluating the codeword at each root.
+ *  Unless expectKernel is false, the kernel must run on a processor
+ *  with SSSE3.
+ */
+template<typename GF, typename T>
+static void checkSyndromeKernel(size_t numParity, uint32_t firstRoot, const GF& primitive, size_t numCodeword, bool expectKernel = true)
+{
+    std::vector<T> received(numCodeword);
+    GFPoly<GF> poly(numCodeword);
+    for (size_t i = 0; i < numCodeword; i++)
+    {
+        received[i] = static_cast<T>(nextRandom() % GF::FIELD_SIZE);
+        poly[numCodeword - 1 - i] = GF(received[i]);
+    }
+
+    RSDecoderKernels<GF> kernels(numParity, firstRoot, primitive.log());
+    std::vector<GF> syndromes(numParity);
+    bool ran = kernels.computeSyndromes(&received[0], numCodeword, &syndromes[0]);
+    assert(ran || !EccCpuFeatures::hasSsse3() || !expectKernel);
+    if (ran)
+    {
+        for (size_t j = 0; j < numParity; j++)
+        {
+            assert(syndromes[j] == poly.eval(primitive.pow(firstRoot + static_cast<uint32_t>(j))));
+        }
+    }
+}
+
+static void syndromeKernel_matchesEvaluation(void)
+{
+    checkSyndromeKernel<GF256, uint8_t>(32, 0, GF256(2), 255);
+    checkSyndromeKernel<GF256, uint8_t>(32, 0, GF256(2), 36);
+    checkSyndromeKernel<GF256, uint32_t>(32, 0, GF256(2), 255);
+    checkSyndromeKernel<GF256, uint8_t>(7, 1, GF256(2), 20);
+    checkSyndromeKernel<GF256, uint8_t>(254, 0, GF256(2), 255);
+    checkSyndromeKernel<GF929, uint16_t>(64, 1, GF929(3), 928);
+    checkSyndromeKernel<GF929, uint16_t>(5, 1, GF929(3), 30);
+    checkSyndromeKernel<GFDM, uint8_t>(62, 1, GFDM(2), 218);
+    checkSyndromeKernel<GF64, uint8_t>(12, 1, GF64(2), 63, false);
+    checkSyndromeKernel<GF1024, uint16_t>(240, 1, GF1024(2), 1020);
+    checkSyndromeKernel<GF1024, uint16_t>(3, 1, GF1024(2), 700);
+    checkSyndromeKernel<GF4096, uint16_t>(400, 1, GF4096(2), 1664);
+    checkSyndromeKernel<GF4096, uint32_t>(16, 1, GF4096(2), 4095);
+}
+
+void rsUnitTests(void)
+{
+    encoder_matchesSample256();
+    encoder_matchesSample929();
+    encoder_randomMessages();
+    encoder_sharedAcrossThreads();
+    tableEncoder_matchesPolynomialParity();
+    tableEncoder_sharedInstances();
+    tableEncoder_zeroParity();
+    encoders_otherPolynomial();
+    splitEncoder_matchesPolynomialParity();
+    batchEncoder_matchesPolynomialParity();
+    decoder_correctsUpToCapacity();
+    decoder_beyondCapacity();
+    decoder_invalidLength();
+    decoder_correctsErrorsAndErasures();
+    decoder_erasuresOnly();
+    decoder_invalidErasures();
+    batchDecoder_matchesSerial();
+    chienKernel_findsKnownRoots();
+    evaluateKernel_matchesHorner();
+    syndromeKernel_matchesEvaluation();
+}
@@ -0,0 +1,277 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef RSBATCHDECODER_DOT_H
+#define RSBATCHDECODER_DOT_H
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include "eccThreadPool.h"
+#include "rsdecoder.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  Decodes many codewords of one code, spread over an EccThreadPool.
+     *
+     *  A clean codeword is rejected after its syndromes, while a damaged
+     *  one goes on through Berlekamp-Massey, the Chien search and Forney,
+     *  so the cost per codeword varies a great deal and an even static
+     *  split would leave threads idle.  Instead the batch is halved
+     *  repeatedly, each upper half becoming a task, down to ranges of
+     *  "grain" codewords.  Idle workers steal the oldest, and so largest,
+     *  ranges still queued, and the work balances itself.
+     *
+     *  Each range borrows an RSDecoder from a free list for its
+     *  workspace, so there are only ever as many decoders as ranges
+     *  running at once - one per thread.  Enough for the pool's threads
+     *  and the caller are built with the batch decoder, so a batch does
+     *  not touch the heap beyond the task queues.
+     *
+     *  decodeBatch may be called from several threads at once.  Without
+     *  a pool, the batch is decoded on the calling thread.
+     */
+    template<typename GF>
+    class RSBatchDecoder
+    {
+    public:
+        static const size_t DEFAULT_GRAIN = 32;
+
+        RSBatchDecoder(size_t numParity, uint32_t firstRoot, const GF& primitive, EccThreadPool *pPool = 0, size_t grain = DEFAULT_GRAIN)
+            :   _numParity(numParity),
+                _firstRoot(firstRoot),
+                _primitive(primitive),
+                _pPool(pPool),
+                _grain(grain > 0 ? grain : 1)
+        {
+            size_t numWorkspaces = (pPool ? pPool->getNumThreads() : 0) + 1;
+            for (size_t k = 0; k < numWorkspaces; k++)
+            {
+                RSDecoder<GF> *pDecoder = new RSDecoder<GF>(numParity, firstRoot, primitive);
+                _workspaces.push_back(std::shared_ptr<RSDecoder<GF> >(pDecoder));
+                _idle.push_back(pDecoder);
+            }
+        }
+
+        size_t getNumParity() const
+        {
+            return _numParity;
+        }
+
+        /*
+         *  Decodes codeword k, of pLengths[k] symbols at ppCodewords[k],
+         *  in place, and stores its outcome in pResults[k].
+         *
+         *  If stopOnFailure is set, the batch is abandoned as soon as any
+         *  codeword cannot be decoded:  codewords not yet started are
+         *  left unchanged and marked RS_SKIPPED.  This suits a batch that
+         *  is only useful whole, such as the blocks of one QR symbol.
+         *  Returns false if any codeword could not be decoded.
+         */
+        template<typename T>
+        bool decodeBatch(T *const *ppCodewords, const size_t *pLengths, size_t numCodewords, RSDecodeStatus *pResults, bool stopOnFailure = false)
+        {
+            ScatteredBatch<T> batch(ppCodewords, pLengths);
+            return decodeAll(batch, numCodewords, pResults, stopOnFailure);
+        }
+
+        /*
+         *  As above, for numCodewords codewords of numCodeword symbols
+         *  each, stored one after another.
+         */
+        template<typename T>
+        bool decodeBatch(T *pCodewords, size_t numCodeword, size_t numCodewords, RSDecodeStatus *pResults, bool stopOnFailure = false)
+        {
+            ContiguousBatch<T> batch(pCodewords, numCodeword);
+            return decodeAll(batch, numCodewords, pResults, stopOnFailure);
+        }
+
+    private:
+        RSBatchDecoder(const RSBatchDecoder&);
+        RSBatchDecoder& operator=(const RSBatchDecoder&);
+
+        template<typename T>
+        struct ScatteredBatch
+        {
+            ScatteredBatch(T *const *ppCodewords, const size_t *pLengths)
+                :   ppCodewords(ppCodewords),
+                    pLengths(pLengths)
+            {
+            }
+
+            T *codeword(size_t k) const
+            {
+                return ppCodewords[k];
+            }
+
+            size_t length(size_t k) const
+            {
+                return pLengths[k];
+            }
+
+            T *const        *ppCodewords;
+            const size_t    *pLengths;
+        };
+
+        template<typename T>
+        struct ContiguousBatch
+        {
+            ContiguousBatch(T *pCodewords, size_t numCodeword)
+                :   pCodewords(pCodewords),
+                    numCodeword(numCodeword)
+            {
+            }
+
+            T *codeword(size_t k) const
+            {
+                return pCodewords + k * numCodeword;
+            }
+
+            size_t length(size_t) const
+            {
+                return numCodeword;
+            }
+
+            T       *pCodewords;
+            size_t  numCodeword;
+        };
+
+        /*
+         *  What the tasks of one batch share.
+         */
+        template<typename Batch>
+        struct Job
+        {
+            Job(const Batch& batch, RSDecodeStatus *pResults, bool stopOnFailure)
+                :   batch(batch),
+                    pResults(pResults),
+                    stopOnFailure(stopOnFailure),
+                    failed(false)
+            {
+            }
+
+            const Batch&        batch;
+            RSDecodeStatus      *pResults;
+            bool                stopOnFailure;
+            std::atomic<bool>   failed;
+        };
+
+        template<typename Batch>
+        bool decodeAll(const Batch& batch, size_t numCodewords, RSDecodeStatus *pResults, bool stopOnFailure)
+        {
+            Job<Batch> job(batch, pResults, stopOnFailure);
+            if (_pPool == 0 || numCodewords <= _grain)
+            {
+                decodeRange(job, 0, numCodewords);
+            }
+            else
+            {
+                EccTaskGroup group(*_pPool);
+                splitRange(group, job, 0, numCodewords);
+                group.wait();
+            }
+
+            return !job.failed;
+        }
+
+        /*
+         *  Queues the upper half of the range until what is left is one
+         *  grain, then decodes that here.
+         */
+        template<typename Batch>
+        void splitRange(EccTaskGroup& group, Job<Batch>& job, size_t begin, size_t end)
+        {
+            while (end - begin > _grain)
+            {
+                size_t middle = begin + (end - begin) / 2;
+                size_t upperEnd = end;
+                Job<Batch> *pJob = &job;
+                group.run([this, &group, pJob, middle, upperEnd]()
+                {
+                    splitRange(group, *pJob, middle, upperEnd);
+                });
+                end = middle;
+            }
+
+            decodeRange(job, begin, end);
+        }
+
+        template<typename Batch>
+        void decodeRange(Job<Batch>& job, size_t begin, size_t end)
+        {
+            RSDecoder<GF> *pDecoder = acquire();
+            for (size_t k = begin; k < end; k++)
+            {
+                if (job.stopOnFailure && job.failed)
+                {
+                    job.pResults[k] = RS_SKIPPED;
+                    continue;
+                }
+
+                RSDecodeStatus status = pDecoder->decode(job.batch.codeword(k), job.batch.length(k));
+                if (status != RS_NO_ERRORS && status != RS_CORRECTED)
+                {
+                    job.failed = true;
+                }
+                job.pResults[k] = status;
+            }
+            release(pDecoder);
+        }
+
+        /*
+         *  A decoder from the free list, or a new one if several batches
+         *  are running at once and the list is empty.
+         */
+        RSDecoder<GF> *acquire()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_lock);
+                if (!_idle.empty())
+                {
+                    RSDecoder<GF> *pDecoder = _idle.back();
+                    _idle.pop_back();
+                    return pDecoder;
+                }
+            }
+
+            RSDecoder<GF> *pDecoder = new RSDecoder<GF>(_numParity, _firstRoot, _primitive);
+            std::lock_guard<std::mutex> lock(_lock);
+            _workspaces.push_back(std::shared_ptr<RSDecoder<GF> >(pDecoder));
+            return pDecoder;
+        }
+
+        void release(RSDecoder<GF> *pDecoder)
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _idle.push_back(pDecoder);
+        }
+
+        size_t                                          _numParity;
+        uint32_t                                        _firstRoot;
+        GF                                              _primitive;
+        EccThreadPool                                   *_pPool;
+        size_t                                          _grain;
+        std::mutex                                      _lock;
+        std::vector<std::shared_ptr<RSDecoder<GF> > >   _workspaces;
+        std::vector<RSDecoder<GF> *>                    _idle;
+    };
+}
+
+#endif  // RSBATCHDECODER_DOT_H
@@ -0,0 +1,270 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef RSBATCHENCODER_DOT_H
+#define RSBATCHENCODER_DOT_H
+
+#include <vector>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+#include "eccCpuFeatures.h"
+#include "gfbinary.h"
+#include "rsencoder.h"
+#include "rstableencoder.h"
+
+#if defined(ECC_X86)
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+namespace SilverBayTech
+{
+    /*
+     *  GF(256) Reed-Solomon encoder for many messages of the same length
+     *  at once, one message per byte lane of an SSE register.
+     *
+     *  Sixteen messages are transposed, sixteen symbols at a time, so
+     *  that each vector holds the same symbol of every message.  The
+     *  shift register then runs on vectors:  the feedback is a vector,
+     *  and each generator coefficient g(j) is the same constant in every
+     *  lane, so f * g(j) is a pair of PSHUFB lookups in g(j)'s nibble
+     *  tables.  At the end the register holds the parity lane-major, and
+     *  is transposed back.
+     *
+     *  The parity is identical to RSEncoder's.  Without SSSE3 each
+     *  message is encoded by the shared RSTableEncoder instead.  The
+     *  encoder is immutable once built, so it may be shared between
+     *  threads.
+     */
+    class RSBatchEncoder
+    {
+    public:
+        static const size_t LANES = 16;
+        static const size_t MAX_PARITY = 255;
+
+        /*
+         *  Builds the tables from an encoder's generator, over any GF(256)
+         *  polynomial.  The code must have fewer than 256 parity symbols.
+         */
+        template<unsigned int POLYNOMIAL>
+        RSBatchEncoder(const RSEncoder<GFBinary<256, POLYNOMIAL> >& encoder)
+            :   _numParity(encoder.getNumParity()),
+                _tables(32 * encoder.getNumParity()),
+                _pFallback(RSTableEncoder::get(encoder.getNumParity(), encoder.getFirstRoot(), encoder.getPrimitive()))
+        {
+            typedef GFBinary<256, POLYNOMIAL> GF256;
+
+            const GFPoly<GF256>& generator = encoder.getGenerator();
+            for (size_t j = 0; j < _numParity; j++)
+            {
+                GF256 coef = generator[_numParity - 1 - j];
+                for (uint32_t x = 0; x < 16; x++)
+                {
+                    _tables[32 * j + x] = static_cast<uint8_t>((coef * GF256(x)).toInt());
+                    _tables[32 * j + 16 + x] = static_cast<uint8_t>((coef * GF256(x << 4)).toInt());
+                }
+            }
+        }
+
+        size_t getNumParity() const
+        {
+            return _numParity;
+        }
+
+        /*
+         *  Computes the getNumParity() parity bytes of each of the
+         *  numMessages messages ppMessages[k], of numMessage bytes each,
+         *  into ppParity[k].
+         */
+        void encodeBatch(const uint8_t *const *ppMessages, size_t numMessage, size_t numMessages, uint8_t *const *ppParity) const
+        {
+#if defined(ECC_X86)
+            if (EccCpuFeatures::hasSsse3() && _numParity > 0)
+            {
+                for (size_t first = 0; first < numMessages; first += LANES)
+                {
+                    /*
+                     *  A short last group repeats its first message in the
+                     *  spare lanes and drops their parity.
+                     */
+                    const uint8_t *lanes[LANES];
+                    uint8_t *parity[LANES];
+                    for (size_t k = 0; k < LANES; k++)
+                    {
+                        bool used = first + k < numMessages;
+                        lanes[k] = ppMessages[used ? first + k : first];
+                        parity[k] = used ? ppParity[first + k] : 0;
+                    }
+
+                    encodeLanes(lanes, numMessage, &_tables[0], _numParity, parity);
+                }
+                return;
+            }
+#endif
+            for (size_t k = 0; k < numMessages; k++)
+            {
+                _pFallback->encode(ppMessages[k], numMessage, ppParity[k]);
+            }
+        }
+
+        /*
+         *  Encodes numCodewords codewords of numCodeword bytes each,
+         *  stored one after another, in place:  the first
+         *  numCodeword - getNumParity() bytes of each are the message,
+         *  and the parity is written after them.
+         */
+        void encodeBatch(uint8_t *pCodewords, size_t numCodeword, size_t numCodewords) const
+        {
+            size_t numMessage = numCodeword - _numParity;
+            for (size_t first = 0; first < numCodewords; first += LANES)
+            {
+                const uint8_t *messages[LANES];
+                uint8_t *parity[LANES];
+                size_t count = numCodewords - first < LANES ? numCodewords - first : LANES;
+                for (size_t k = 0; k < count; k++)
+                {
+                    messages[k] = pCodewords + (first + k) * numCodeword;
+                    parity[k] = pCodewords + (first + k) * numCodeword + numMessage;
+                }
+
+                encodeBatch(messages, numMessage, count, parity);
+            }
+        }
+
+    private:
+#if defined(ECC_X86)
+        /*
+         *  Transposes a 16 x 16 block of bytes.  Each round interleaves
+         *  row r with row r + 8, and four rounds move every index bit of
+         *  the row number into the column number.
+         */
+        ECC_TARGET("sse2")
+        static void transpose(__m128i *pRows)
+        {
+            __m128i interleaved[16];
+            for (size_t round = 0; round < 4; round++)
+            {
+                for (size_t r = 0; r < 8; r++)
+                {
+                    interleaved[2 * r] = _mm_unpacklo_epi8(pRows[r], pRows[r + 8]);
+                    interleaved[2 * r + 1] = _mm_unpackhi_epi8(pRows[r], pRows[r + 8]);
+                }
+
+                for (size_t r = 0; r < 16; r++)
+                {
+                    pRows[r] = interleaved[r];
+                }
+            }
+        }
+
+        /*
+         *  One shift register step for sixteen messages, merging the
+         *  shift with the feedback:  P(j) = P(j + 1) + f * g(j).
+         */
+        ECC_TARGET("ssse3")
+        static void shiftIn(__m128i *pRegister, __m128i symbol, const uint8_t *pTables, size_t numParity)
+        {
+            __m128i mask = _mm_set1_epi8(0x0F);
+            __m128i feedback = _mm_xor_si128(symbol, pRegister[0]);
+            __m128i lowNibbles = _mm_and_si128(feedback, mask);
+            __m128i highNibbles = _mm_and_si128(_mm_srli_epi64(feedback, 4), mask);
+
+            for (size_t j = 0; j < numParity; j++)
+            {
+                __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pTables + 32 * j));
+                __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pTables + 32 * j + 16));
+                __m128i product = _mm_xor_si128(_mm_shuffle_epi8(low, lowNibbles), _mm_shuffle_epi8(high, highNibbles));
+                __m128i next = (j + 1 < numParity) ? pRegister[j + 1] : _mm_setzero_si128();
+                pRegister[j] = _mm_xor_si128(next, product);
+            }
+        }
+
+        ECC_TARGET("ssse3")
+        static void encodeLanes(const uint8_t *const *ppMessages, size_t numMessage, const uint8_t *pTables, size_t numParity, uint8_t *const *ppParity)
+        {
+            __m128i reg[MAX_PARITY];
+            for (size_t j = 0; j < numParity; j++)
+            {
+                reg[j] = _mm_setzero_si128();
+            }
+
+            __m128i block[LANES];
+            size_t i = 0;
+            for (; i + LANES <= numMessage; i += LANES)
+            {
+                for (size_t k = 0; k < LANES; k++)
+                {
+                    block[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ppMessages[k] + i));
+                }
+                transpose(block);
+
+                for (size_t s = 0; s < LANES; s++)
+                {
+                    shiftIn(reg, block[s], pTables, numParity);
+                }
+            }
+
+            for (; i < numMessage; i++)
+            {
+                uint8_t column[LANES];
+                for (size_t k = 0; k < LANES; k++)
+                {
+                    column[k] = ppMessages[k][i];
+                }
+                shiftIn(reg, _mm_loadu_si128(reinterpret_cast<const __m128i *>(column)), pTables, numParity);
+            }
+
+            size_t j = 0;
+            for (; j + LANES <= numParity; j += LANES)
+            {
+                for (size_t s = 0; s < LANES; s++)
+                {
+                    block[s] = reg[j + s];
+                }
+                transpose(block);
+
+                for (size_t k = 0; k < LANES; k++)
+                {
+                    if (ppParity[k] != 0)
+                    {
+                        _mm_storeu_si128(reinterpret_cast<__m128i *>(ppParity[k] + j), block[k]);
+                    }
+                }
+            }
+
+            for (; j < numParity; j++)
+            {
+                uint8_t column[LANES];
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(column), reg[j]);
+                for (size_t k = 0; k < LANES; k++)
+                {
+                    if (ppParity[k] != 0)
+                    {
+                        ppParity[k][j] = column[k];
+                    }
+                }
+            }
+        }
+#endif
+
+        size_t                                  _numParity;
+        std::vector<uint8_t>                    _tables;        // nibble products of g's coefficient of x^(numParity-1-j)
+        std::shared_ptr<const RSTableEncoder>   _pFallback;
+    };
+}
+
+#endif  // RSBATCHENCODER_DOT_H
@@ -0,0 +1,208 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef RSENCODER_DOT_H
+#define RSENCODER_DOT_H
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include "gfpoly.h"
+#include "gfpolyprepared.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  Systematic Reed-Solomon encoder.  The code has numParity parity
+     *  symbols and generator polynomial
+     *
+     *      g(x) = (x - a^f)(x - a^(f+1)) ... (x - a^(f+numParity-1))
+     *
+     *  where a is the primitive element and f the first consecutive
+     *  root - rs256sample uses a = 2, f = 0 and rs929sample a = 3, f = 1.
+     *  A codeword is the message followed by the parity, the negated
+     *  remainder of message * x^numParity divided by g, so every
+     *  codeword is a multiple of g.
+     *
+     *  The generator is built once, when the encoder is constructed, and
+     *  prepared as a PreparedDivisor.  The encoder is immutable
+     *  afterwards, so one encoder may be used from several threads at
+     *  once.  Parity is computed by the usual linear feedback shift
+     *  register (PreparedDivisor::shiftInParity), directly in the
+     *  caller's parity buffer, so encoding neither allocates nor copies.
+     *
+     *  Symbols are passed in transmission order (highest exponent first)
+     *  as any type that converts to and from uint32_t - typically uint8_t
+     *  for GF(256) and uint16_t for GF(929) - and must already be valid
+     *  field elements.
+     */
+    template<typename GF>
+    class RSEncoder
+    {
+    public:
+        RSEncoder(size_t numParity, uint32_t firstRoot, const GF& primitive)
+            :   _numParity(numParity),
+                _firstRoot(firstRoot),
+                _primitive(primitive),
+                _generator(buildGenerator(numParity, firstRoot, primitive))
+        {
+        }
+
+        /*
+         *  Shared encoder for the specified parameters, built on first
+         *  use and kept for the life of the process.  Safe to call from
+         *  any thread, but not from static initializers.
+         */
+        static std::shared_ptr<const RSEncoder<GF> > get(size_t numParity, uint32_t firstRoot, const GF& primitive)
+        {
+            Key key = makeKey(numParity, firstRoot, primitive.toInt());
+
+            std::lock_guard<std::mutex> lock(s_cache.lock);
+            std::shared_ptr<const RSEncoder<GF> >& entry = s_cache.encoders[key];
+            if (!entry)
+            {
+                entry.reset(new RSEncoder<GF>(numParity, firstRoot, primitive));
+            }
+
+            return entry;
+        }
+
+        size_t getNumParity() const
+        {
+            return _numParity;
+        }
+
+        uint32_t getFirstRoot() const
+        {
+            return _firstRoot;
+        }
+
+        const GF& getPrimitive() const
+        {
+            return _primitive;
+        }
+
+        /*
+         *  The monic generator polynomial.
+         */
+        const GFPoly<GF>& getGenerator() const
+        {
+            return _generator.getMonic();
+        }
+
+        /*
+         *  Computes the getNumParity() parity symbols for the message into
+         *  pParity.  The two buffers must not overlap.
+         */
+        template<typename T>
+        void encode(const T *pMessage, size_t numMessage, T *pParity) const
+        {
+            for (size_t j = 0; j < _numParity; j++)
+            {
+                pParity[j] = static_cast<T>(0);
+            }
+
+            for (size_t i = 0; i < numMessage; i++)
+            {
+                _generator.shiftInParity(pParity, GF(pMessage[i]));
+            }
+        }
+
+        /*
+         *  Encodes in place: the first numCodeword - getNumParity()
+         *  symbols are the message, and the parity is written after them.
+         */
+        template<typename T>
+        void encode(T *pCodeword, size_t numCodeword) const
+        {
+            size_t numMessage = numCodeword - _numParity;
+            encode(pCodeword, numMessage, pCodeword + numMessage);
+        }
+
+        /*
+         *  Polynomial form: returns message * x^numParity - remainder.
+         */
+        GFPoly<GF> encode(const GFPoly<GF>& message) const
+        {
+            size_t numMessage = message.getNumCoef();
+            std::vector<GF> codeword(numMessage + _numParity);
+            for (size_t i = 0; i < numMessage; i++)
+            {
+                codeword[i] = message[numMessage - 1 - i];
+            }
+
+            encode(&codeword[0], codeword.size());
+
+            GFPoly<GF> output(codeword.size());
+            for (size_t i = 0; i < codeword.size(); i++)
+            {
+                output[i] = codeword[codeword.size() - 1 - i];
+            }
+
+            return output;
+        }
+
+    private:
+        typedef std::pair<std::pair<size_t, uint32_t>, uint32_t> Key;
+
+        struct Cache
+        {
+            std::mutex                                              lock;
+            std::map<Key, std::shared_ptr<const RSEncoder<GF> > >   encoders;
+        };
+
+        static Key makeKey(size_t numParity, uint32_t firstRoot, uint32_t primitive)
+        {
+            return Key(std::make_pair(numParity, firstRoot), primitive);
+        }
+
+        /*
+         *  (x - a^f)(x - a^(f+1)) ... (x - a^(f+numParity-1)), which is
+         *  monic already.
+         */
+        static GFPoly<GF> buildGenerator(size_t numParity, uint32_t firstRoot, const GF& primitive)
+        {
+            GFPoly<GF> generator(numParity + 1);
+            generator[0] = GF(1);
+            for (size_t i = 0; i < numParity; i++)
+            {
+                GF root = primitive.pow(firstRoot + static_cast<uint32_t>(i));
+                for (size_t k = i + 1; k > 0; k--)
+                {
+                    generator[k] = generator[k - 1] - root * generator[k];
+                }
+                generator[0] = -root * generator[0];
+            }
+
+            return generator;
+        }
+
+        size_t                  _numParity;
+        uint32_t                _firstRoot;
+        GF                      _primitive;
+        PreparedDivisor<GF>     _generator;
+
+        static Cache s_cache;
+    };
+
+    template<typename GF>
+    typename RSEncoder<GF>::Cache RSEncoder<GF>::s_cache;
+}
+
+#endif  // RSENCODER_DOT_H
@@ -0,0 +1,1076 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef RSKERNELS_DOT_H
+#define RSKERNELS_DOT_H
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+#include "eccCpuFeatures.h"
+#include "gfbinary.h"
+#include "gfprime.h"
+#include "rstableencoder.h"
+
+#if defined(ECC_X86)
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+namespace SilverBayTech
+{
+    /*
+     *  Field-specific fast paths for RSDecoder.  Each kernel returns
+     *  false if it does not handle the case, and the decoder then uses
+     *  its portable code.  The general template handles nothing.
+     *
+     *  Syndrome kernels keep all numParity Horner accumulators
+     *  S(j) = S(j) * a^(f+j) + r(i) in vector registers, one lane per
+     *  root, so the codeword is read once rather than once per root.
+     */
+    template<typename GF>
+    class RSDecoderKernels
+    {
+    public:
+        RSDecoderKernels(size_t, uint32_t, uint32_t)
+        {
+        }
+
+        template<typename T>
+        bool computeSyndromes(const T *, size_t, GF *) const
+        {
+            return false;
+        }
+
+        bool chienSearch(const GF *, size_t, size_t, size_t *, uint32_t *, size_t&) const
+        {
+            return false;
+        }
+
+        bool evaluate(const GF *, size_t, const GF&, GF&) const
+        {
+            return false;
+        }
+    };
+
+    /*
+     *  GF(256) kernels.  Multiplying sixteen bytes by one constant c is
+     *  two SSSE3 PSHUFB table lookups, since
+     *  c * x = c * (x & 0x0F) + c * (x & 0xF0), and each half has only
+     *  sixteen possible values.  The syndromes need a different
+     *  constant in each lane, so there x * c is built bit by bit from
+     *  the per-lane products c * 2^b, which needs only SSE2.  Every
+     *  table is built from the field's own arithmetic, so the kernels
+     *  serve each GF(256) polynomial alike.
+     */
+    template<unsigned int POLYNOMIAL>
+    class RSDecoderKernels<GFBinary<256, POLYNOMIAL> >
+    {
+    public:
+        typedef GFBinary<256, POLYNOMIAL> GF256;
+
+        /*
+         *  The Chien search steps each locator term i by a^(16 i), so
+         *  the tables for those constants are built here, for locators
+         *  of degree up to numParity (with erasures, the errata locator
+         *  may reach that.)  The syndrome tables hold
+         *  a^(f+j) * 2^b for lane j, in eight vectors per sixteen roots.
+         *  The table encoder used for division is the shared one from
+         *  RSTableEncoder::get.
+         */
+        RSDecoderKernels(size_t numParity, uint32_t firstRoot, uint32_t primitiveLog)
+            :   _numParity(numParity),
+                _primitiveLog(primitiveLog),
+                _maxDegree(numParity),
+                _rootLogs(numParity),
+                _stepTables(32 * (numParity + 1)),
+                _rootTables(128 * ((numParity + 15) / 16)),
+                _remainderMinLength(remainderCrossover(numParity))
+        {
+            if (_remainderMinLength <= 255)
+            {
+                GF256 primitive = GF256::exp(primitiveLog);
+                _pDivider = RSTableEncoder::get(numParity, firstRoot, primitive);
+            }
+
+            for (size_t i = 0; i <= _maxDegree; i++)
+            {
+                GF256 step = GF256::exp(static_cast<uint32_t>((16 * i * primitiveLog) % 255));
+                buildMultiplyTable(step, &_stepTables[32 * i]);
+            }
+
+            for (size_t j = 0; j < numParity; j++)
+            {
+                _rootLogs[j] = static_cast<uint32_t>(((firstRoot + j) % 255) * primitiveLog % 255);
+                GF256 root = GF256::exp(_rootLogs[j]);
+                for (uint32_t b = 0; b < 8; b++)
+                {
+                    GF256 product = root * GF256(1u << b);
+                    _rootTables[128 * (j / 16) + 16 * b + j % 16] = static_cast<uint8_t>(product.toInt());
+                }
+            }
+        }
+
+        /*
+         *  All numParity syndromes.  A codeword r = q g + R has the same
+         *  syndromes as its remainder R, since the roots are the roots
+         *  of g, so long codewords are first divided by the table
+         *  encoder and only the numParity symbols of R are evaluated -
+         *  with SIMD where the processor has it, and otherwise by
+         *  Horner's rule.  Shorter ones, where the division does not
+         *  pay, are evaluated directly.
+         */
+        bool computeSyndromes(const uint8_t *pCodeword, size_t numCodeword, GF256 *pSyndromes) const
+        {
+            if (!_pDivider || numCodeword < _remainderMinLength)
+            {
+                return evaluateSyndromes(pCodeword, numCodeword, pSyndromes);
+            }
+
+            /*
+             *  The encoder gives -(m x^n mod g) for the message part m,
+             *  so R is the received parity minus that.
+             */
+            uint8_t remainder[RSTableEncoder::MAX_PARITY];
+            size_t numMessage = numCodeword - _numParity;
+            _pDivider->encode(pCodeword, numMessage, remainder);
+            for (size_t j = 0; j < _numParity; j++)
+            {
+                remainder[j] ^= pCodeword[numMessage + j];
+            }
+
+            if (!evaluateSyndromes(remainder, _numParity, pSyndromes))
+            {
+                hornerSyndromes(remainder, _numParity, pSyndromes);
+            }
+
+            return true;
+        }
+
+        template<typename T>
+        bool computeSyndromes(const T *pCodeword, size_t numCodeword, GF256 *pSyndromes) const
+        {
+            return evaluateSyndromes(pCodeword, numCodeword, pSyndromes);
+        }
+
+        /*
+         *  Chien search over sixteen positions at a time.  Lane k of
+         *  vector i holds locator term i at position p + k; summing the
+         *  vectors gives the locator at all sixteen positions, and
+         *  multiplying vector i by a^(16 i) moves it on to p + 16.
+         *  Stops once degree roots are found.
+         */
+        bool chienSearch(const GF256 *pLambda, size_t degree, size_t numCodeword, size_t *pPositions, uint32_t *pExponents, size_t& found) const
+        {
+#if defined(ECC_X86)
+            if (!EccCpuFeatures::hasSsse3() || degree > _maxDegree || degree > MAX_DEGREE)
+            {
+                return false;
+            }
+
+            uint8_t initial[16 * (MAX_DEGREE + 1)];
+            uint32_t startLog = static_cast<uint32_t>((255 - (numCodeword - 1) % 255) * _primitiveLog % 255);
+            for (size_t i = 0; i <= degree; i++)
+            {
+                for (size_t k = 0; k < 16; k++)
+                {
+                    uint8_t value = 0;
+                    if (pLambda[i].toInt() != 0)
+                    {
+                        uint32_t log = pLambda[i].log() + static_cast<uint32_t>((i * (startLog + k * _primitiveLog)) % 255);
+                        value = static_cast<uint8_t>(GF256::exp(log).toInt());
+                    }
+                    initial[16 * i + k] = value;
+                }
+            }
+
+            found = chienSsse3(initial, &_stepTables[0], degree, numCodeword, pPositions, pExponents);
+            return true;
+#else
+            (void) pLambda;
+            (void) degree;
+            (void) numCodeword;
+            (void) pPositions;
+            (void) pExponents;
+            (void) found;
+            return false;
+#endif
+        }
+
+        bool evaluate(const GF256 *, size_t, const GF256&, GF256&) const
+        {
+            return false;
+        }
+
+    private:
+        /*
+         *  Direct evaluation, all roots at once, one lane per root.
+         */
+        template<typename T>
+        bool evaluateSyndromes(const T *pCodeword, size_t numCodeword, GF256 *pSyndromes) const
+        {
+#if defined(ECC_X86)
+            size_t numVectors = (_numParity + 15) / 16;
+            if (!EccCpuFeatures::hasSse2() || numVectors == 0 || numVectors > MAX_VECTORS)
+            {
+                return false;
+            }
+
+            syndromesSse2(pCodeword, numCodeword, &_rootTables[0], _numParity, pSyndromes);
+            return true;
+#else
+            (void) pCodeword;
+            (void) numCodeword;
+            (void) pSyndromes;
+            return false;
+#endif
+        }
+
+        /*
+         *  Horner's rule one root at a time, for a remainder that the SIMD
+         *  loop cannot take.
+         */
+        void hornerSyndromes(const uint8_t *pRemainder, size_t numRemainder, GF256 *pSyndromes) const
+        {
+            for (size_t j = 0; j < _numParity; j++)
+            {
+                GF256 sum;
+                for (size_t i = 0; i < numRemainder; i++)
+                {
+                    if (sum.toInt() != 0)
+                    {
+                        sum = GF256::exp(sum.log() + _rootLogs[j]);
+                    }
+                    sum = sum + GF256(pRemainder[i]);
+                }
+                pSyndromes[j] = sum;
+            }
+        }
+
+        static const size_t MAX_DEGREE = 255;
+        static const size_t MAX_VECTORS = 16;
+
+        /*
+         *  Shortest codeword for which dividing first is faster.  The
+         *  division reads the message eight symbols per table step, while
+         *  direct evaluation steps every root for every symbol, so
+         *  division wins once there is a full slice of message.  With 32
+         *  parity symbols, a 40 symbol codeword takes 0.33 us by division
+         *  against 0.41 us direct, and a 255 symbol one 0.96 us against
+         *  2.4 us.
+         *  Only codes of very low rate, with less than a slice of
+         *  message, are evaluated directly.
+         */
+        static size_t remainderCrossover(size_t numParity)
+        {
+            return numParity == 0 ? 256 : numParity + RSTableEncoder::SLICE;
+        }
+
+        /*
+         *  Products of c with 0x00 ... 0x0F, then with 0x00 ... 0xF0.
+         */
+        static void buildMultiplyTable(const GF256& c, uint8_t *pTable)
+        {
+            for (uint32_t x = 0; x < 16; x++)
+            {
+                pTable[x] = static_cast<uint8_t>((c * GF256(x)).toInt());
+                pTable[16 + x] = static_cast<uint8_t>((c * GF256(x << 4)).toInt());
+            }
+        }
+
+#if defined(ECC_X86)
+        /*
+         *  The loop of evaluateSyndromes, sixteen roots to a vector.
+         */
+        template<typename T>
+        ECC_TARGET("sse2")
+        static void syndromesSse2(const T *pCodeword, size_t numCodeword, const uint8_t *pRootTables, size_t numParity, GF256 *pSyndromes)
+        {
+            size_t numVectors = (numParity + 15) / 16;
+            __m128i sums[MAX_VECTORS];
+            for (size_t v = 0; v < numVectors; v++)
+            {
+                sums[v] = _mm_setzero_si128();
+            }
+
+            const __m128i *pTables = reinterpret_cast<const __m128i *>(pRootTables);
+            __m128i zero = _mm_setzero_si128();
+            for (size_t i = 0; i < numCodeword; i++)
+            {
+                __m128i symbol = _mm_set1_epi8(static_cast<char>(pCodeword[i]));
+                for (size_t v = 0; v < numVectors; v++)
+                {
+                    /*
+                     *  Doubling each byte moves bit b up to the sign bit
+                     *  in turn, starting from the top bit.
+                     */
+                    __m128i bits = sums[v];
+                    __m128i product = symbol;
+                    for (size_t b = 8; b > 0; b--)
+                    {
+                        __m128i mask = _mm_cmplt_epi8(bits, zero);
+                        product = _mm_xor_si128(product, _mm_and_si128(mask, _mm_loadu_si128(pTables + 8 * v + b - 1)));
+                        bits = _mm_add_epi8(bits, bits);
+                    }
+                    sums[v] = product;
+                }
+            }
+
+            for (size_t v = 0; v < numVectors; v++)
+            {
+                uint8_t lanes[16];
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), sums[v]);
+                for (size_t k = 0; k < 16 && 16 * v + k < numParity; k++)
+                {
+                    pSyndromes[16 * v + k] = GF256(lanes[k]);
+                }
+            }
+        }
+
+        ECC_TARGET("ssse3")
+        static __m128i multiply(__m128i x, __m128i low, __m128i high)
+        {
+            __m128i mask = _mm_set1_epi8(0x0F);
+            __m128i lowNibbles = _mm_and_si128(x, mask);
+            __m128i highNibbles = _mm_and_si128(_mm_srli_epi64(x, 4), mask);
+            return _mm_xor_si128(_mm_shuffle_epi8(low, lowNibbles), _mm_shuffle_epi8(high, highNibbles));
+        }
+
+        ECC_TARGET("ssse3")
+        static size_t chienSsse3(const uint8_t *pInitial, const uint8_t *pTables, size_t degree, size_t numCodeword, size_t *pPositions, uint32_t *pExponents)
+        {
+            __m128i terms[MAX_DEGREE + 1];
+            for (size_t i = 0; i <= degree; i++)
+            {
+                terms[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pInitial + 16 * i));
+            }
+
+            size_t found = 0;
+            __m128i zero = _mm_setzero_si128();
+            for (size_t base = 0; base < numCodeword; base += 16)
+            {
+                __m128i sum = terms[0];
+                for (size_t i = 1; i <= degree; i++)
+                {
+                    sum = _mm_xor_si128(sum, terms[i]);
+                }
+
+                unsigned int roots = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(sum, zero)));
+                if (numCodeword - base < 16)
+                {
+                    roots &= (1u << (numCodeword - base)) - 1;
+                }
+
+                for (size_t k = 0; roots != 0; k++, roots >>= 1)
+                {
+                    if (roots & 1)
+                    {
+                        pPositions[found] = base + k;
+                        pExponents[found] = static_cast<uint32_t>(numCodeword - 1 - base - k);
+                        if (++found == degree)
+                        {
+                            return found;
+                        }
+                    }
+                }
+
+                for (size_t i = 1; i <= degree; i++)
+                {
+                    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pTables + 32 * i));
+                    __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pTables + 32 * i + 16));
+                    terms[i] = multiply(terms[i], low, high);
+                }
+            }
+
+            return found;
+        }
+#endif
+
+        size_t                  _numParity;
+        uint32_t                _primitiveLog;
+        size_t                  _maxDegree;
+        std::vector<uint32_t>   _rootLogs;
+        std::vector<uint8_t>    _stepTables;
+        std::vector<uint8_t>    _rootTables;
+        size_t                  _remainderMinLength;
+        std::shared_ptr<const RSTableEncoder>   _pDivider;
+    };
+
+    /*
+     *  Kernels for the other binary fields of up to 4096 elements - the
+     *  Aztec fields GF(16), GF(64), GF(1024) and GF(4096).  Symbols are
+     *  held byte-planar, sixteen to a pair of vectors:  one of their low
+     *  bytes and one of their high bytes.  A symbol has at most three
+     *  nibbles, and multiplying by a constant c is linear, so
+     *
+     *      c * x = c * n0 + c * (n1 << 4) + c * (n2 << 8)
+     *
+     *  and each term is a PSHUFB lookup in a 16-entry split table, one
+     *  for each output byte:  six lookups in 96 bytes of tables, where a
+     *  full product table for GF(4096) would take 8K per constant.
+     *
+     *  The Chien search works as for GF(256), and Forney's evaluations
+     *  as for prime fields, sixteen lanes wide.  The syndromes are taken
+     *  one root at a time instead:  the codeword is cut into sixteen
+     *  segments, lane l runs Horner's rule for the root r over segment
+     *  l, and S = sum of segment(l) r^(m (15 - l)) for segments of m
+     *  symbols.
+     */
+    template<unsigned int SIZE, unsigned int POLYNOMIAL>
+    class RSDecoderKernels<GFBinary<SIZE, POLYNOMIAL> >
+    {
+    public:
+        typedef GFBinary<SIZE, POLYNOMIAL> GF;
+
+        /*
+         *  The tables for the roots a^(f+j) and the Chien steps a^(16 i)
+         *  are built here, 96 bytes each, with room for the longest
+         *  codeword in the syndrome workspace.
+         */
+        RSDecoderKernels(size_t numParity, uint32_t firstRoot, uint32_t primitiveLog)
+            :   _numParity(numParity),
+                _primitiveLog(primitiveLog),
+                _rootLogs(numParity),
+                _rootTables(TABLE_SIZE * numParity),
+                _stepTables(TABLE_SIZE * (numParity + 1)),
+                _terms(32 * (numParity + 1)),
+                _planes(SIZE > MAX_SIZE ? 0 : 32 * ((SIZE + 14) / 16))
+        {
+            if (SIZE > MAX_SIZE)
+            {
+                return;
+            }
+
+            uint64_t order = SIZE - 1;
+            for (size_t j = 0; j < numParity; j++)
+            {
+                _rootLogs[j] = static_cast<uint32_t>((((firstRoot + j) % order) * primitiveLog) % order);
+                buildMultiplyTable(GF::exp(_rootLogs[j]), &_rootTables[TABLE_SIZE * j]);
+            }
+
+            for (size_t i = 0; i <= numParity; i++)
+            {
+                buildMultiplyTable(GF::exp(static_cast<uint32_t>((16 * i * primitiveLog) % order)), &_stepTables[TABLE_SIZE * i]);
+            }
+        }
+
+        template<typename T>
+        bool computeSyndromes(const T *pCodeword, size_t numCodeword, GF *pSyndromes)
+        {
+#if defined(ECC_X86)
+            if (SIZE > MAX_SIZE || !EccCpuFeatures::hasSsse3() || numCodeword < MIN_SYNDROME_LENGTH)
+            {
+                return false;
+            }
+
+            /*
+             *  Segment l is padded symbols l m ... l m + m - 1, where the
+             *  leading zeros of the padding change nothing.
+             */
+            size_t length = (numCodeword + 15) / 16;
+            size_t pad = 16 * length - numCodeword;
+            if (32 * length > _planes.size())
+            {
+                return false;
+            }
+
+            for (size_t t = 0; t < length; t++)
+            {
+                for (size_t l = 0; l < 16; l++)
+                {
+                    size_t index = l * length + t;
+                    uint32_t symbol = index < pad ? 0 : static_cast<uint32_t>(pCodeword[index - pad]);
+                    _planes[32 * t + l] = static_cast<uint8_t>(symbol);
+                    _planes[32 * t + 16 + l] = static_cast<uint8_t>(symbol >> 8);
+                }
+            }
+
+            uint64_t order = SIZE - 1;
+            for (size_t j = 0; j < _numParity; j++)
+            {
+                uint16_t lanes[16];
+                evaluateSegments(&_planes[0], length, &_rootTables[TABLE_SIZE * j], lanes);
+
+                GF step = GF::exp(static_cast<uint32_t>((static_cast<uint64_t>(_rootLogs[j]) * length) % order));
+                GF sum;
+                for (size_t l = 0; l < 16; l++)
+                {
+                    sum = sum * step + GF(lanes[l]);
+                }
+                pSyndromes[j] = sum;
+            }
+
+            return true;
+#else
+            (void) pCodeword;
+            (void) numCodeword;
+            (void) pSyndromes;
+            return false;
+#endif
+        }
+
+        /*
+         *  Sixteen positions at a time:  lane k of term i holds locator
+         *  term i at position p + k, and multiplying by a^(16 i) moves it
+         *  on to p + 16.  Stops once degree roots are found.
+         */
+        bool chienSearch(const GF *pLambda, size_t degree, size_t numCodeword, size_t *pPositions, uint32_t *pExponents, size_t& found)
+        {
+#if defined(ECC_X86)
+            if (SIZE > MAX_SIZE || !EccCpuFeatures::hasSsse3() || degree > _numParity)
+            {
+                return false;
+            }
+
+            uint64_t order = SIZE - 1;
+            uint64_t startLog = ((order - (numCodeword - 1) % order) * _primitiveLog) % order;
+            for (size_t i = 0; i <= degree; i++)
+            {
+                for (size_t k = 0; k < 16; k++)
+                {
+                    uint32_t value = 0;
+                    if (pLambda[i].toInt() != 0)
+                    {
+                        uint64_t log = pLambda[i].log() + (i * ((startLog + k * _primitiveLog) % order)) % order;
+                        value = GF::exp(static_cast<uint32_t>(log % order)).toInt();
+                    }
+                    _terms[32 * i + k] = static_cast<uint8_t>(value);
+                    _terms[32 * i + 16 + k] = static_cast<uint8_t>(value >> 8);
+                }
+            }
+
+            found = chienSsse3(&_terms[0], &_stepTables[0], degree, numCodeword, pPositions, pExponents);
+            return true;
+#else
+            (void) pLambda;
+            (void) degree;
+            (void) numCodeword;
+            (void) pPositions;
+            (void) pExponents;
+            (void) found;
+            return false;
+#endif
+        }
+
+        /*
+         *  value = sum of pCoef[i] x^i, for Forney's formula.  Lane l
+         *  runs Horner's rule in x^16 over coefficients l, l + 16, ...,
+         *  and the lanes are then combined with powers of x.  Short
+         *  polynomials are left to the scalar loop.
+         */
+        bool evaluate(const GF *pCoef, size_t numCoef, const GF& x, GF& value) const
+        {
+#if defined(ECC_X86)
+            if (SIZE > MAX_SIZE || !EccCpuFeatures::hasSsse3() || numCoef < MIN_EVALUATE)
+            {
+                return false;
+            }
+
+            uint8_t table[TABLE_SIZE];
+            buildMultiplyTable(x.pow(16), table);
+
+            uint16_t lanes[16];
+            evaluateChunks(pCoef, numCoef, table, lanes);
+
+            value = GF(0);
+            for (size_t l = 16; l > 0; l--)
+            {
+                value = value * x + GF(lanes[l - 1]);
+            }
+
+            return true;
+#else
+            (void) pCoef;
+            (void) numCoef;
+            (void) x;
+            (void) value;
+            return false;
+#endif
+        }
+
+    private:
+        static const unsigned int MAX_SIZE = 4096;
+        static const size_t TABLE_SIZE = 96;
+        static const size_t MIN_SYNDROME_LENGTH = 64;
+        static const size_t MIN_EVALUATE = 48;
+
+        /*
+         *  c times each nibble value in each of the three nibble
+         *  positions, as three low-byte tables and then three high-byte
+         *  tables.  Each entry is the sum of c 2^b over its bits, from
+         *  the entry without its lowest bit.  Nibble values beyond the
+         *  field never occur.
+         */
+        static void buildMultiplyTable(const GF& c, uint8_t *pTable)
+        {
+            GF power = c;
+            for (uint32_t n = 0; n < 3; n++)
+            {
+                uint32_t products[16] = { 0 };
+                for (uint32_t b = 0; b < 4; b++)
+                {
+                    uint32_t bit = 1u << b;
+                    if ((bit << (4 * n)) < SIZE)
+                    {
+                        products[bit] = power.toInt();
+                        power = power * GF(2);
+                    }
+                }
+
+                for (uint32_t x = 1; x < 16; x++)
+                {
+                    uint32_t lowest = x & (0 - x);
+                    products[x] = products[x & (x - 1)] ^ products[lowest];
+                }
+
+                for (uint32_t x = 0; x < 16; x++)
+                {
+                    pTable[16 * n + x] = static_cast<uint8_t>(products[x]);
+                    pTable[48 + 16 * n + x] = static_cast<uint8_t>(products[x] >> 8);
+                }
+            }
+        }
+
+#if defined(ECC_X86)
+        /*
+         *  Multiplies sixteen byte-planar symbols by the table's constant.
+         */
+        ECC_TARGET("ssse3")
+        static void multiply(__m128i& low, __m128i& high, const uint8_t *pTable)
+        {
+            const __m128i *pVectors = reinterpret_cast<const __m128i *>(pTable);
+            __m128i mask = _mm_set1_epi8(0x0F);
+            __m128i n0 = _mm_and_si128(low, mask);
+            __m128i n1 = _mm_and_si128(_mm_srli_epi64(low, 4), mask);
+            __m128i n2 = _mm_and_si128(high, mask);
+
+            low = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(_mm_loadu_si128(pVectors), n0),
+                                              _mm_shuffle_epi8(_mm_loadu_si128(pVectors + 1), n1)),
+                                _mm_shuffle_epi8(_mm_loadu_si128(pVectors + 2), n2));
+            high = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(_mm_loadu_si128(pVectors + 3), n0),
+                                               _mm_shuffle_epi8(_mm_loadu_si128(pVectors + 4), n1)),
+                                 _mm_shuffle_epi8(_mm_loadu_si128(pVectors + 5), n2));
+        }
+
+        /*
+         *  Horner's rule in each lane over length symbols of the planes.
+         */
+        ECC_TARGET("ssse3")
+        static void evaluateSegments(const uint8_t *pPlanes, size_t length, const uint8_t *pTable, uint16_t *pLanes)
+        {
+            const __m128i *pVectors = reinterpret_cast<const __m128i *>(pPlanes);
+            __m128i low = _mm_setzero_si128();
+            __m128i high = _mm_setzero_si128();
+            for (size_t t = 0; t < length; t++)
+            {
+                multiply(low, high, pTable);
+                low = _mm_xor_si128(low, _mm_loadu_si128(pVectors + 2 * t));
+                high = _mm_xor_si128(high, _mm_loadu_si128(pVectors + 2 * t + 1));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(pLanes), _mm_unpacklo_epi8(low, high));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(pLanes + 8), _mm_unpackhi_epi8(low, high));
+        }
+
+        ECC_TARGET("ssse3")
+        static void evaluateChunks(const GF *pCoef, size_t numCoef, const uint8_t *pTable, uint16_t *pLanes)
+        {
+            __m128i low = _mm_setzero_si128();
+            __m128i high = _mm_setzero_si128();
+            for (size_t chunk = (numCoef + 15) / 16; chunk > 0; chunk--)
+            {
+                uint8_t planes[32];
+                for (size_t l = 0; l < 16; l++)
+                {
+                    size_t i = 16 * (chunk - 1) + l;
+                    uint32_t coef = i < numCoef ? pCoef[i].toInt() : 0;
+                    planes[l] = static_cast<uint8_t>(coef);
+                    planes[16 + l] = static_cast<uint8_t>(coef >> 8);
+                }
+
+                multiply(low, high, pTable);
+                low = _mm_xor_si128(low, _mm_loadu_si128(reinterpret_cast<const __m128i *>(planes)));
+                high = _mm_xor_si128(high, _mm_loadu_si128(reinterpret_cast<const __m128i *>(planes + 16)));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(pLanes), _mm_unpacklo_epi8(low, high));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(pLanes + 8), _mm_unpackhi_epi8(low, high));
+        }
+
+        ECC_TARGET("ssse3")
+        static size_t chienSsse3(uint8_t *pTerms, const uint8_t *pTables, size_t degree, size_t numCodeword, size_t *pPositions, uint32_t *pExponents)
+        {
+            __m128i *pVectors = reinterpret_cast<__m128i *>(pTerms);
+            size_t found = 0;
+            __m128i zero = _mm_setzero_si128();
+            for (size_t base = 0; base < numCodeword; base += 16)
+            {
+                __m128i low = _mm_loadu_si128(pVectors);
+                __m128i high = _mm_loadu_si128(pVectors + 1);
+                for (size_t i = 1; i <= degree; i++)
+                {
+                    low = _mm_xor_si128(low, _mm_loadu_si128(pVectors + 2 * i));
+                    high = _mm_xor_si128(high, _mm_loadu_si128(pVectors + 2 * i + 1));
+                }
+                __m128i sum = _mm_or_si128(low, high);
+
+                unsigned int roots = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(sum, zero)));
+                if (numCodeword - base < 16)
+                {
+                    roots &= (1u << (numCodeword - base)) - 1;
+                }
+
+                for (size_t k = 0; roots != 0; k++, roots >>= 1)
+                {
+                    if (roots & 1)
+                    {
+                        pPositions[found] = base + k;
+                        pExponents[found] = static_cast<uint32_t>(numCodeword - 1 - base - k);
+                        if (++found == degree)
+                        {
+                            return found;
+                        }
+                    }
+                }
+
+                for (size_t i = 1; i <= degree; i++)
+                {
+                    __m128i termLow = _mm_loadu_si128(pVectors + 2 * i);
+                    __m128i termHigh = _mm_loadu_si128(pVectors + 2 * i + 1);
+                    multiply(termLow, termHigh, pTables + TABLE_SIZE * i);
+                    _mm_storeu_si128(pVectors + 2 * i, termLow);
+                    _mm_storeu_si128(pVectors + 2 * i + 1, termHigh);
+                }
+            }
+
+            return found;
+        }
+#endif
+
+        size_t                  _numParity;
+        uint32_t                _primitiveLog;
+        std::vector<uint32_t>   _rootLogs;
+        std::vector<uint8_t>    _rootTables;
+        std::vector<uint8_t>    _stepTables;
+        std::vector<uint8_t>    _terms;         // Chien search workspace
+        std::vector<uint8_t>    _planes;        // syndrome workspace
+    };
+
+    /*
+     *  Prime field kernels using SSE2, eight 16-bit lanes at a time.
+     *  The syndrome roots are fixed, so each lane multiplies by Shoup's
+     *  method:  with w' = floor(w * 2^16 / p), q = hi16(x * w') is the
+     *  quotient of x * w / p or one less, and x * w - q * p is found in
+     *  the low sixteen bits and then reduced by one conditional
+     *  subtraction.  This needs 2p < 2^15, so larger fields use the
+     *  portable code.
+     */
+    template<unsigned int SIZE>
+    class RSDecoderKernels<GFPrime<SIZE> >
+    {
+    public:
+        typedef GFPrime<SIZE> GF;
+
+        /*
+         *  Besides the syndrome roots, the Chien search steps locator
+         *  term i by a^(8 i), for locators of degree up to numParity.
+         */
+        RSDecoderKernels(size_t numParity, uint32_t firstRoot, uint32_t primitiveLog)
+            :   _numParity(numParity),
+                _primitiveLog(primitiveLog),
+                _roots(8 * ((numParity + 7) / 8)),
+                _shoupRoots(8 * ((numParity + 7) / 8)),
+                _steps(numParity + 1),
+                _shoupSteps(numParity + 1),
+                _terms(8 * (numParity + 1))
+        {
+            for (size_t j = 0; j < numParity; j++)
+            {
+                uint64_t exponent = static_cast<uint64_t>((firstRoot + j) % (SIZE - 1)) * primitiveLog;
+                uint32_t root = GF::exp(static_cast<uint32_t>(exponent % (SIZE - 1))).toInt();
+                _roots[j] = static_cast<uint16_t>(root);
+                _shoupRoots[j] = shoup(root);
+            }
+
+            for (size_t i = 0; i <= numParity; i++)
+            {
+                uint64_t exponent = (8 * static_cast<uint64_t>(i) * primitiveLog) % (SIZE - 1);
+                uint32_t step = GF::exp(static_cast<uint32_t>(exponent)).toInt();
+                _steps[i] = static_cast<uint16_t>(step);
+                _shoupSteps[i] = shoup(step);
+            }
+        }
+
+        /*
+         *  All numParity syndromes in one pass over the codeword.
+         */
+        template<typename T>
+        bool computeSyndromes(const T *pCodeword, size_t numCodeword, GF *pSyndromes) const
+        {
+#if defined(ECC_X86)
+            size_t numVectors = (_numParity + 7) / 8;
+            if (SIZE >= MAX_SIZE || !EccCpuFeatures::hasSse2() || numVectors == 0 || numVectors > MAX_VECTORS)
+            {
+                return false;
+            }
+
+            syndromesSse2(pCodeword, numCodeword, &_roots[0], &_shoupRoots[0], _numParity, pSyndromes);
+            return true;
+#else
+            (void) pCodeword;
+            (void) numCodeword;
+            (void) pSyndromes;
+            return false;
+#endif
+        }
+
+        /*
+         *  Chien search over eight positions at a time, as for GF(256):
+         *  lane k of vector i holds locator term i at position p + k,
+         *  and multiplying by a^(8 i) moves it on to p + 8.  Stops once
+         *  degree roots are found.
+         */
+        bool chienSearch(const GF *pLambda, size_t degree, size_t numCodeword, size_t *pPositions, uint32_t *pExponents, size_t& found)
+        {
+#if defined(ECC_X86)
+            if (SIZE >= MAX_SIZE || !EccCpuFeatures::hasSse2() || degree > _numParity)
+            {
+                return false;
+            }
+
+            uint64_t order = SIZE - 1;
+            uint64_t startLog = ((order - (numCodeword - 1) % order) * _primitiveLog) % order;
+            for (size_t i = 0; i <= degree; i++)
+            {
+                for (size_t k = 0; k < 8; k++)
+                {
+                    uint16_t value = 0;
+                    if (pLambda[i].toInt() != 0)
+                    {
+                        uint64_t log = pLambda[i].log() + (i * ((startLog + k * _primitiveLog) % order)) % order;
+                        value = static_cast<uint16_t>(GF::exp(static_cast<uint32_t>(log % order)).toInt());
+                    }
+                    _terms[8 * i + k] = value;
+                }
+            }
+
+            found = chienSse2(&_terms[0], &_steps[0], &_shoupSteps[0], degree, numCodeword, pPositions, pExponents);
+            return true;
+#else
+            (void) pLambda;
+            (void) degree;
+            (void) numCodeword;
+            (void) pPositions;
+            (void) pExponents;
+            (void) found;
+            return false;
+#endif
+        }
+
+        /*
+         *  value = sum of pCoef[i] x^i, for Forney's formula.  Lane l
+         *  runs Horner's rule in x^8 over coefficients l, l + 8, ..., and
+         *  the lanes are then combined with powers of x.  Short
+         *  polynomials are left to the scalar loop.
+         */
+        bool evaluate(const GF *pCoef, size_t numCoef, const GF& x, GF& value) const
+        {
+#if defined(ECC_X86)
+            if (SIZE >= MAX_SIZE || !EccCpuFeatures::hasSse2() || numCoef < MIN_EVALUATE)
+            {
+                return false;
+            }
+
+            GF x2 = x * x;
+            GF x4 = x2 * x2;
+            uint32_t x8 = (x4 * x4).toInt();
+
+            uint16_t lanes[8];
+            evaluateChunks(pCoef, numCoef, x8, lanes);
+            value = GF(0);
+            for (size_t l = 8; l > 0; l--)
+            {
+                value = value * x + GF(lanes[l - 1]);
+            }
+
+            return true;
+#else
+            (void) pCoef;
+            (void) numCoef;
+            (void) x;
+            (void) value;
+            return false;
+#endif
+        }
+
+    private:
+        static const unsigned int MAX_SIZE = 16384;
+        static const size_t MAX_VECTORS = 128;
+        static const size_t MIN_EVALUATE = 32;
+
+        static uint16_t shoup(uint32_t w)
+        {
+            return static_cast<uint16_t>((w << 16) / SIZE);
+        }
+
+#if defined(ECC_X86)
+        /*
+         *  x * w for each lane, given w' = shoup(w).
+         */
+        ECC_TARGET("sse2")
+        static __m128i multiply(__m128i x, __m128i w, __m128i shoupW)
+        {
+            __m128i modulus = _mm_set1_epi16(static_cast<short>(SIZE));
+            __m128i q = _mm_mulhi_epu16(x, shoupW);
+            __m128i r = _mm_sub_epi16(_mm_mullo_epi16(x, w), _mm_mullo_epi16(q, modulus));
+            return reduce(r);
+        }
+
+        ECC_TARGET("sse2")
+        static __m128i add(__m128i x, __m128i y)
+        {
+            return reduce(_mm_add_epi16(x, y));
+        }
+
+        /*
+         *  Brings lanes in [0, 2p) into [0, p).
+         */
+        ECC_TARGET("sse2")
+        static __m128i reduce(__m128i x)
+        {
+            __m128i modulus = _mm_set1_epi16(static_cast<short>(SIZE));
+            __m128i limit = _mm_set1_epi16(static_cast<short>(SIZE - 1));
+            return _mm_sub_epi16(x, _mm_and_si128(_mm_cmpgt_epi16(x, limit), modulus));
+        }
+
+        /*
+         *  The loop of computeSyndromes, eight roots to a vector.
+         */
+        template<typename T>
+        ECC_TARGET("sse2")
+        static void syndromesSse2(const T *pCodeword, size_t numCodeword, const uint16_t *pRootValues, const uint16_t *pShoupRootValues, size_t numParity, GF *pSyndromes)
+        {
+            size_t numVectors = (numParity + 7) / 8;
+            __m128i sums[MAX_VECTORS];
+            for (size_t v = 0; v < numVectors; v++)
+            {
+                sums[v] = _mm_setzero_si128();
+            }
+
+            const __m128i *pRoots = reinterpret_cast<const __m128i *>(pRootValues);
+            const __m128i *pShoupRoots = reinterpret_cast<const __m128i *>(pShoupRootValues);
+            for (size_t i = 0; i < numCodeword; i++)
+            {
+                __m128i symbol = _mm_set1_epi16(static_cast<short>(pCodeword[i]));
+                for (size_t v = 0; v < numVectors; v++)
+                {
+                    __m128i product = multiply(sums[v], _mm_loadu_si128(pRoots + v), _mm_loadu_si128(pShoupRoots + v));
+                    sums[v] = add(product, symbol);
+                }
+            }
+
+            for (size_t v = 0; v < numVectors; v++)
+            {
+                uint16_t lanes[8];
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), sums[v]);
+                for (size_t k = 0; k < 8 && 8 * v + k < numParity; k++)
+                {
+                    pSyndromes[8 * v + k] = GF(lanes[k]);
+                }
+            }
+        }
+
+        ECC_TARGET("sse2")
+        static size_t chienSse2(uint16_t *pTermValues, const uint16_t *pSteps, const uint16_t *pShoupSteps, size_t degree, size_t numCodeword, size_t *pPositions, uint32_t *pExponents)
+        {
+            __m128i *pTerms = reinterpret_cast<__m128i *>(pTermValues);
+            __m128i zero = _mm_setzero_si128();
+            size_t found = 0;
+            for (size_t base = 0; base < numCodeword; base += 8)
+            {
+                __m128i sum = _mm_loadu_si128(pTerms);
+                for (size_t i = 1; i <= degree; i++)
+                {
+                    sum = add(sum, _mm_loadu_si128(pTerms + i));
+                }
+
+                /*
+                 *  Two mask bits per 16-bit lane; keep the low one.
+                 */
+                unsigned int roots = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi16(sum, zero))) & 0x5555;
+                if (numCodeword - base < 8)
+                {
+                    roots &= (1u << (2 * (numCodeword - base))) - 1;
+                }
+
+                for (size_t k = 0; roots != 0; k++, roots >>= 2)
+                {
+                    if (roots & 1)
+                    {
+                        pPositions[found] = base + k;
+                        pExponents[found] = static_cast<uint32_t>(numCodeword - 1 - base - k);
+                        if (++found == degree)
+                        {
+                            return found;
+                        }
+                    }
+                }
+
+                for (size_t i = 1; i <= degree; i++)
+                {
+                    __m128i step = _mm_set1_epi16(static_cast<short>(pSteps[i]));
+                    __m128i shoupStep = _mm_set1_epi16(static_cast<short>(pShoupSteps[i]));
+                    _mm_storeu_si128(pTerms + i, multiply(_mm_loadu_si128(pTerms + i), step, shoupStep));
+                }
+            }
+
+            return found;
+        }
+
+        ECC_TARGET("sse2")
+        static void evaluateChunks(const GF *pCoef, size_t numCoef, uint32_t x8, uint16_t *pLanes)
+        {
+            __m128i power = _mm_set1_epi16(static_cast<short>(x8));
+            __m128i shoupPower = _mm_set1_epi16(static_cast<short>(shoup(x8)));
+
+            __m128i sum = _mm_setzero_si128();
+            for (size_t chunk = (numCoef + 7) / 8; chunk > 0; chunk--)
+            {
+                uint16_t coefs[8];
+                for (size_t l = 0; l < 8; l++)
+                {
+                    size_t i = 8 * (chunk - 1) + l;
+                    coefs[l] = static_cast<uint16_t>(i < numCoef ? pCoef[i].toInt() : 0);
+                }
+
+                sum = add(multiply(sum, power, shoupPower), _mm_loadu_si128(reinterpret_cast<const __m128i *>(coefs)));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(pLanes), sum);
+        }
+#endif
+
+        size_t                  _numParity;
+        uint64_t                _primitiveLog;
+        std::vector<uint16_t>   _roots;
+        std::vector<uint16_t>   _shoupRoots;
+        std::vector<uint16_t>   _steps;
+        std::vector<uint16_t>   _shoupSteps;
+        std::vector<uint16_t>   _terms;         // Chien search workspace
+    };
+}
+
+#endif  // RSKERNELS_DOT_H
@@ -0,0 +1,201 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef RSSPLITENCODER_DOT_H
+#define RSSPLITENCODER_DOT_H
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include "gfbinary.h"
+#include "rsencoder.h"
+
+namespace SilverBayTech
+{
+    /*
+     *  Table-driven Reed-Solomon encoder for the binary fields of up to
+     *  4096 elements, with 16-bit symbols - the Aztec fields.  A table
+     *  row per feedback value, as in RSTableEncoder, would take 4096 rows
+     *  for GF(4096), so the feedback f is split into its nibbles instead.
+     *  Multiplying by f is linear, so
+     *
+     *      f * (x^n mod g) = sum of T(i)[nibble i of f]
+     *
+     *  where T(i)[v] = (v << 4i) * x^n mod g.  Each step shifts the
+     *  register up one symbol and XORs in the three rows in the same
+     *  pass, four symbols to a 64-bit word, in place of a field
+     *  multiplication per parity symbol.  The pass writes a second
+     *  register, so it has no dependencies from word to word, and the
+     *  two swap after each step.  Rows for nibbles beyond the field are
+     *  zero.
+     *
+     *  The tables take 48 rows of ceil(n / 4) words - 38K for 400
+     *  parity symbols over GF(4096).  The parity is bit-identical to
+     *  RSEncoder, and the encoder is immutable once built, so it may be
+     *  shared between threads.
+     */
+    template<unsigned int SIZE, unsigned int POLYNOMIAL>
+    class RSSplitEncoder
+    {
+    public:
+        typedef GFBinary<SIZE, POLYNOMIAL> GF;
+
+        static const size_t SYMBOLS_PER_WORD = 4;
+        static const size_t MAX_PARITY = SIZE - 1;
+        static const size_t MAX_WORDS = (MAX_PARITY + SYMBOLS_PER_WORD - 1) / SYMBOLS_PER_WORD;
+        static const size_t NUM_NIBBLES = 3;
+
+        /*
+         *  Builds the tables from an encoder's generator.  The code must
+         *  have fewer than SIZE parity symbols.
+         */
+        RSSplitEncoder(const RSEncoder<GF>& encoder)
+            :   _numParity(encoder.getNumParity()),
+                _numWords((encoder.getNumParity() + SYMBOLS_PER_WORD - 1) / SYMBOLS_PER_WORD),
+                _pad(SYMBOLS_PER_WORD * _numWords - encoder.getNumParity()),
+                _tables(NUM_NIBBLES * 16 * _numWords)
+        {
+            /*
+             *  x^n mod g, lowest exponent first, is -(g - x^n).
+             */
+            const GFPoly<GF>& generator = encoder.getGenerator();
+            for (size_t i = 0; i < NUM_NIBBLES; i++)
+            {
+                for (uint32_t v = 0; v < 16; v++)
+                {
+                    uint32_t operand = v << (4 * i);
+                    if (operand >= SIZE)
+                    {
+                        continue;
+                    }
+
+                    uint64_t *pRow = row(i, v);
+                    for (size_t k = 0; k < _numParity; k++)
+                    {
+                        uint64_t product = (GF(operand) * -generator[k]).toInt();
+                        size_t symbol = k + _pad;
+                        pRow[symbol / SYMBOLS_PER_WORD] |= product << (16 * (symbol % SYMBOLS_PER_WORD));
+                    }
+                }
+            }
+        }
+
+        /*
+         *  Shared split-table encoder for the specified parameters, built
+         *  on first use and kept for the life of the process.  Safe to
+         *  call from any thread, but not from static initializers.
+         */
+        static std::shared_ptr<const RSSplitEncoder<SIZE, POLYNOMIAL> > get(size_t numParity, uint32_t firstRoot, const GF& primitive)
+        {
+            Key key(std::make_pair(numParity, firstRoot), primitive.toInt());
+
+            std::lock_guard<std::mutex> lock(s_cache.lock);
+            std::shared_ptr<const RSSplitEncoder<SIZE, POLYNOMIAL> >& entry = s_cache.encoders[key];
+            if (!entry)
+            {
+                entry.reset(new RSSplitEncoder<SIZE, POLYNOMIAL>(*RSEncoder<GF>::get(numParity, firstRoot, primitive)));
+            }
+
+            return entry;
+        }
+
+        size_t getNumParity() const
+        {
+            return _numParity;
+        }
+
+        /*
+         *  Computes the getNumParity() parity symbols for the message into
+         *  pParity, highest exponent first.
+         */
+        void encode(const uint16_t *pMessage, size_t numMessage, uint16_t *pParity) const
+        {
+            /*
+             *  Each register has a zero word below it, shifted into the
+             *  bottom word.
+             */
+            uint64_t registers[2][MAX_WORDS + 1] = { { 0 } };
+            uint64_t *pReg = registers[0] + 1;
+            uint64_t *pNext = registers[1] + 1;
+            size_t top = _numWords - 1;
+
+            for (size_t i = 0; i < numMessage && _numParity > 0; i++)
+            {
+                uint32_t feedback = pMessage[i] ^ static_cast<uint32_t>(pReg[top] >> 48);
+                const uint64_t *pRow0 = row(0, feedback & 0xF);
+                const uint64_t *pRow1 = row(1, (feedback >> 4) & 0xF);
+                const uint64_t *pRow2 = row(2, (feedback >> 8) & 0xF);
+                for (size_t w = 0; w < _numWords; w++)
+                {
+                    pNext[w] = ((pReg[w] << 16) | (pReg[w - 1] >> 48)) ^ pRow0[w] ^ pRow1[w] ^ pRow2[w];
+                }
+
+                std::swap(pReg, pNext);
+            }
+
+            for (size_t j = 0; j < _numParity; j++)
+            {
+                size_t symbol = _numParity - 1 - j + _pad;
+                pParity[j] = static_cast<uint16_t>(pReg[symbol / SYMBOLS_PER_WORD] >> (16 * (symbol % SYMBOLS_PER_WORD)));
+            }
+        }
+
+        /*
+         *  Encodes in place: the first numCodeword - getNumParity()
+         *  symbols are the message, and the parity is written after them.
+         */
+        void encode(uint16_t *pCodeword, size_t numCodeword) const
+        {
+            size_t numMessage = numCodeword - _numParity;
+            encode(pCodeword, numMessage, pCodeword + numMessage);
+        }
+
+    private:
+        typedef std::pair<std::pair<size_t, uint32_t>, uint32_t> Key;
+
+        struct Cache
+        {
+            std::mutex                                                                  lock;
+            std::map<Key, std::shared_ptr<const RSSplitEncoder<SIZE, POLYNOMIAL> > >   encoders;
+        };
+
+        uint64_t *row(size_t i, size_t v)
+        {
+            return &_tables[(i * 16 + v) * _numWords];
+        }
+
+        const uint64_t *row(size_t i, size_t v) const
+        {
+            return &_tables[(i * 16 + v) * _numWords];
+        }
+
+        size_t                  _numParity;
+        size_t                  _numWords;
+        size_t                  _pad;
+        std::vector<uint64_t>   _tables;
+
+        static Cache s_cache;
+    };
+
+    template<unsigned int SIZE, unsigned int POLYNOMIAL>
+    typename RSSplitEncoder<SIZE, POLYNOMIAL>::Cache RSSplitEncoder<SIZE, POLYNOMIAL>::s_cache;
+}
+
+#endif  // RSSPLITENCODER_DOT_H
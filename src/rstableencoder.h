@@ -0,0 +1,255 @@
+/*
+ *  Copyright (c) 2014 Kevin Hunter
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and 
+ *  limitations under the License.
+ */
+
+#ifndef RSTABLEENCODER_DOT_H
+#define RSTABLEENCODER_DOT_H
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include "gfbinary.h"
+#include "rsencoder.h"
+
+namespace SilverBayTech
+{
+    class RSTableEncoder;
+
+    /*
+     *  Storage for RSTableEncoder::get.  It is a template only so that
+     *  its static member can be defined in this header.
+     */
+    template<typename Unused>
+    struct RSTableEncoderCache
+    {
+        typedef std::pair<std::pair<size_t, uint32_t>, std::pair<uint32_t, uint32_t> > Key;    // numParity, first root, primitive, polynomial
+
+        struct Entries
+        {
+            std::mutex                                                  lock;
+            std::map<Key, std::shared_ptr<const RSTableEncoder> >       encoders;
+        };
+
+        static Entries s_entries;
+    };
+
+    /*
+     *  Table-driven Reed-Solomon encoder for GF(256), processing eight
+     *  message bytes per step in the manner of a slice-by-8 CRC.
+     *
+     *  With R the remainder register and m0 ... m7 the next message
+     *  bytes, the eight feedback bytes f(i) = m(i) + R(n-1-i) all come
+     *  from the register as it stands, so
+     *
+     *      R' = R * x^8 + sum of T(7-i)[f(i)]
+     *
+     *  where T(j)[v] = v * x^(n+j) mod g.  The eight table rows are
+     *  independent, unlike the serial feedback of the shift register,
+     *  and each row is XORed in eight bytes at a time.  The register is
+     *  kept in 64-bit words with the top coefficient in the top byte, so
+     *  shifting by eight symbols is a word move.  Messages shorter than
+     *  eight bytes, the tail of a message, and codes with fewer than
+     *  eight parity symbols use T(0) one byte at a time.
+     *
+     *  The tables take 8 * 256 * ceil(n / 8) words (20K for the ten
+     *  parity symbols of rs256sample.)  The parity is bit-identical to
+     *  RSEncoder and to -((message << n) % generator).  A code with no
+     *  parity symbols has no tables, and encoding it writes nothing.  The
+     *  encoder is immutable once built, so it may be shared between
+     *  threads.
+     *
+     *  Only the tables depend on the field, so one class serves every
+     *  GF(256) polynomial:  the QR Code field, GFBinary<256>, and the
+     *  Data Matrix field, GFBinary<256, 0x12D>, alike.
+     */
+    class RSTableEncoder
+    {
+    public:
+        static const size_t SLICE = 8;
+        static const size_t MAX_PARITY = 255;
+
+        /*
+         *  Builds the tables from an encoder's generator.  The code must
+         *  have fewer than 256 parity symbols, and may have none.
+         */
+        template<unsigned int POLYNOMIAL>
+        RSTableEncoder(const RSEncoder<GFBinary<256, POLYNOMIAL> >& encoder)
+            :   _numParity(encoder.getNumParity()),
+                _numWords((encoder.getNumParity() + 7) / 8),
+                _pad(8 * ((encoder.getNumParity() + 7) / 8) - encoder.getNumParity())
+        {
+            typedef GFBinary<256, POLYNOMIAL> GF256;
+
+            if (_numParity == 0)
+            {
+                return;
+            }
+
+            const GFPoly<GF256>& generator = encoder.getGenerator();
+            _tables.resize(SLICE * 256 * _numWords);
+
+            /*
+             *  x^(n+j) mod g, lowest exponent first, starting from
+             *  x^n mod g = -(g - x^n).
+             */
+            std::vector<GF256> power(_numParity);
+            for (size_t k = 0; k < _numParity; k++)
+            {
+                power[k] = -generator[k];
+            }
+
+            for (size_t j = 0; j < SLICE; j++)
+            {
+                for (uint32_t v = 0; v < 256; v++)
+                {
+                    uint64_t *pRow = row(j, v);
+                    for (size_t k = 0; k < _numParity; k++)
+                    {
+                        uint64_t product = (GF256(v) * power[k]).toInt();
+                        size_t byte = k + _pad;
+                        pRow[byte / 8] |= product << (8 * (byte % 8));
+                    }
+                }
+
+                GF256 top = power[_numParity - 1];
+                for (size_t k = _numParity - 1; k > 0; k--)
+                {
+                    power[k] = power[k - 1] - top * generator[k];
+                }
+                power[0] = -top * generator[0];
+            }
+        }
+
+        /*
+         *  Shared table encoder for the specified parameters, built on
+         *  first use and kept for the life of the process.  Safe to call
+         *  from any thread, but not from static initializers.
+         */
+        template<unsigned int POLYNOMIAL>
+        static std::shared_ptr<const RSTableEncoder> get(size_t numParity, uint32_t firstRoot, const GFBinary<256, POLYNOMIAL>& primitive)
+        {
+            typedef RSTableEncoderCache<void> Cache;
+            Cache::Key key(std::make_pair(numParity, firstRoot), std::make_pair(primitive.toInt(), POLYNOMIAL));
+
+            std::lock_guard<std::mutex> lock(Cache::s_entries.lock);
+            std::shared_ptr<const RSTableEncoder>& entry = Cache::s_entries.encoders[key];
+            if (!entry)
+            {
+                entry.reset(new RSTableEncoder(*RSEncoder<GFBinary<256, POLYNOMIAL> >::get(numParity, firstRoot, primitive)));
+            }
+
+            return entry;
+        }
+
+        size_t getNumParity() const
+        {
+            return _numParity;
+        }
+
+        /*
+         *  Computes the getNumParity() parity bytes for the message into
+         *  pParity, highest exponent first.
+         */
+        void encode(const uint8_t *pMessage, size_t numMessage, uint8_t *pParity) const
+        {
+            uint64_t reg[(MAX_PARITY + 7) / 8] = { 0 };
+            size_t i = 0;
+
+            if (_numParity >= SLICE)
+            {
+                for (; i + SLICE <= numMessage; i += SLICE)
+                {
+                    uint64_t top = reg[_numWords - 1];
+                    for (size_t w = _numWords - 1; w > 0; w--)
+                    {
+                        reg[w] = reg[w - 1];
+                    }
+                    reg[0] = 0;
+
+                    for (size_t s = 0; s < SLICE; s++)
+                    {
+                        size_t feedback = pMessage[i + s] ^ static_cast<size_t>((top >> (8 * (SLICE - 1 - s))) & 0xFF);
+                        const uint64_t *pRow = row(SLICE - 1 - s, feedback);
+                        for (size_t w = 0; w < _numWords; w++)
+                        {
+                            reg[w] ^= pRow[w];
+                        }
+                    }
+                }
+            }
+
+            for (; i < numMessage && _numParity > 0; i++)
+            {
+                size_t feedback = pMessage[i] ^ static_cast<size_t>(reg[_numWords - 1] >> 56);
+                for (size_t w = _numWords - 1; w > 0; w--)
+                {
+                    reg[w] = (reg[w] << 8) | (reg[w - 1] >> 56);
+                }
+                reg[0] <<= 8;
+
+                const uint64_t *pRow = row(0, feedback);
+                for (size_t w = 0; w < _numWords; w++)
+                {
+                    reg[w] ^= pRow[w];
+                }
+            }
+
+            for (size_t j = 0; j < _numParity; j++)
+            {
+                size_t byte = _numParity - 1 - j + _pad;
+                pParity[j] = static_cast<uint8_t>(reg[byte / 8] >> (8 * (byte % 8)));
+            }
+        }
+
+        /*
+         *  Encodes in place: the first numCodeword - getNumParity() bytes
+         *  are the message, and the parity is written after them.
+         */
+        void encode(uint8_t *pCodeword, size_t numCodeword) const
+        {
+            size_t numMessage = numCodeword - _numParity;
+            encode(pCodeword, numMessage, pCodeword + numMessage);
+        }
+
+    private:
+        /*
+         *  Table T(j)[v].  There are no tables when there is no parity,
+         *  so this must only be called when _numParity > 0.
+         */
+        uint64_t *row(size_t j, size_t v)
+        {
+            return &_tables[(j * 256 + v) * _numWords];
+        }
+
+        const uint64_t *row(size_t j, size_t v) const
+        {
+            return &_tables[(j * 256 + v) * _numWords];
+        }
+
+        size_t                  _numParity;
+        size_t                  _numWords;
+        size_t                  _pad;
+        std::vector<uint64_t>   _tables;
+
+    };
+
+    template<typename Unused>
+    typename RSTableEncoderCache<Unused>::Entries RSTableEncoderCache<Unused>::s_entries;
+}
+
+#endif  // RSTABLEENCODER_DOT_H